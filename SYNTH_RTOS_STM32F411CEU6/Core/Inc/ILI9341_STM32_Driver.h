@@ -110,6 +110,60 @@ extern SPI_HandleTypeDef hspi2;
 
 #define BURST_MAX_SIZE 	500
 
+// DMA 전송 (LCD_Task 는 전송 중 세마포어 대기 → CPU 양보)
+// 호스트 확인: Tools/lcd_sim (SPI 바이트 스트림 모델, DMA 중 CS/DC 변경 / CS high 전송 검출)
+#define LCD_LINE_PIXELS     320     // 라인 버퍼 픽셀 수 (가로 한 줄)
+#define LCD_DMA_MIN_BYTES   16      // 이보다 짧으면 폴링 (DMA 설정 + 문맥 전환이 더 비쌈)
+#define LCD_SPI_TIMEOUT_MS  100
+
+// 픽셀 스트림(Line_Submit, Draw_Colour_Burst)을 16비트 SPI 프레임으로 전송
+// - SPI 가 16비트 값을 상위 바이트부터 내보냄 → 라인 버퍼에 RGB565 를 그대로 저장 (스왑 없음)
+// - 명령/좌표, Write_Buffer, Draw_Image 같은 바이트 스트림은 8비트 프레임
+// - 0 이면 기존 방식 (8비트 프레임, 라인 버퍼에 바이트 스왑된 값)
+#ifndef LCD_SPI_16BIT
+#define LCD_SPI_16BIT       1
+#endif
+
+// SPI 클럭 프로파일 (SPI2 는 APB1 50 MHz, 분주비 /2 가 SPI2 최대)
+// - ILI9341 데이터시트 쓰기 주기는 66 ns (약 15 MHz), FAST 는 규격 밖이지만 짧은 배선에서 동작
+// - 초기화 명령은 SAFE 로 보내고 ILI9341_Init 끝에서 LCD_SPI_PROFILE_DEFAULT 로 전환
+typedef enum {
+	LCD_SPI_SAFE = 0,     // /8 = 6.25 MHz (긴 배선, 점퍼선)
+	LCD_SPI_NORMAL,       // /4 = 12.5 MHz (데이터시트 이내)
+	LCD_SPI_FAST,         // /2 = 25 MHz
+	LCD_SPI_PROFILE_COUNT
+} LCD_SPI_Profile_t;
+
+#ifndef LCD_SPI_PROFILE_DEFAULT
+#define LCD_SPI_PROFILE_DEFAULT   LCD_SPI_FAST
+#endif
+
+typedef struct {
+	uint32_t bytes;       // 전송 바이트 누적
+	uint32_t dma_xfers;   // DMA 전송 횟수
+	uint32_t poll_xfers;  // 폴링 전송 횟수
+	uint32_t timeouts;    // 완료 대기 타임아웃 (SPI abort)
+	uint32_t windows;     // 주소 창 설정 횟수 (Set_Address / Draw_Pixel)
+	uint32_t pixels;      // 전송 픽셀 수 (명령/좌표 바이트 제외)
+	uint32_t reconfigs;   // SPI 프레임 크기/클럭 전환 횟수 (SPI 끄고 CR1 변경)
+} LCD_SPI_Stats_t;
+
+extern volatile LCD_SPI_Stats_t g_lcd_spi_stats;
+
+// 현재 회전 기준 화면 크기 (Set_Rotation 에서 갱신)
+extern volatile uint16_t LCD_HEIGHT;
+extern volatile uint16_t LCD_WIDTH;
+
+// RGB565 → 라인 버퍼 값 (LCD 는 상위 바이트를 먼저 받아야 함)
+// 16비트 프레임이면 그대로, 8비트 프레임이면 메모리 순서(하위 바이트 먼저)를 뒤집어 저장
+static inline uint16_t ILI9341_LineColour(uint16_t c) {
+#if LCD_SPI_16BIT
+	return c;
+#else
+	return (uint16_t) ((c << 8) | (c >> 8));
+#endif
+}
+
 #define BLACK       0x0000      
 #define NAVY        0x000F      
 #define DARKGREEN   0x03E0      
@@ -136,6 +190,9 @@ extern SPI_HandleTypeDef hspi2;
 #define SCREEN_HORIZONTAL_2		3
 
 void ILI9341_SPI_Init(void);
+void ILI9341_SPI_SetProfile(LCD_SPI_Profile_t profile);
+LCD_SPI_Profile_t ILI9341_SPI_GetProfile(void);
+uint32_t ILI9341_SPI_Hz(void);   // 현재 SCK 주파수
 void ILI9341_SPI_Send(unsigned char SPI_Data);
 void ILI9341_Write_Command(uint8_t Command);
 void ILI9341_Write_Data(uint8_t Data);
@@ -153,6 +210,16 @@ void ILI9341_Draw_Colour_Burst(uint16_t Colour, uint32_t Size);
 void ILI9341_Draw_Rectangle(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, uint16_t Colour);
 void ILI9341_Draw_Horizontal_Line(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Colour);
 void ILI9341_Draw_Vertical_Line(uint16_t X, uint16_t Y, uint16_t Height, uint16_t Colour);
+
+// 픽셀 스트림: Begin → (Line_Acquire → 채우기 → Line_Submit) x N → End
+// - Line_Acquire 는 두 버퍼를 번갈아 반환, Submit 은 이전 전송 완료 후 DMA 시작
+// - Write_Buffer 는 호출자 버퍼(플래시 이미지 등)를 보내고 완료 후 반환
+void ILI9341_Begin_Pixels(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
+uint16_t* ILI9341_Line_Acquire(void);
+void ILI9341_Line_Submit(const uint16_t *line, uint16_t pixels);
+void ILI9341_Write_Buffer(const uint8_t *data, uint32_t len);
+void ILI9341_End_Pixels(void);
+void ILI9341_Flush(void);
 	
 #endif
 
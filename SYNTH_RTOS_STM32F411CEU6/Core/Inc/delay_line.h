@@ -0,0 +1,82 @@
+/*
+ * delay_line.h
+ *
+ *  int16 원형 버퍼 딜레이 라인 (딜레이 / 리버브 / 코러스 공용)
+ *  - 버퍼는 호출하는 쪽에서 정적으로 할당 (FreeRTOS 힙 사용 안 함)
+ *  - 나머지(%) 연산 없이 비교 1번으로 wrap
+ *  - 블록 처리 시 DL_Span()으로 wrap 없이 연속 처리 가능한 길이를 구해서 사용
+ *  - 모듈레이션 딜레이(코러스 등)는 DL_ReadFrac()으로 소수 샘플 보간 읽기
+ */
+
+#ifndef INC_DELAY_LINE_H_
+#define INC_DELAY_LINE_H_
+
+#include <stdint.h>
+
+typedef struct {
+	int16_t *buf;
+	uint32_t size;     // 샘플 수
+	uint32_t pos;      // 다음 쓰기 위치
+} DelayLine_t;
+
+static inline void DL_Init(DelayLine_t *dl, int16_t *buf, uint32_t size) {
+	dl->buf = buf;
+	dl->size = size;
+	dl->pos = 0;
+	for (uint32_t i = 0; i < size; i++)
+		buf[i] = 0;
+}
+
+// 쓰기 위치 기준 delay 샘플 전 인덱스 (0 < delay <= size)
+static inline uint32_t DL_Index(const DelayLine_t *dl, uint32_t delay) {
+	return (dl->pos >= delay) ? dl->pos - delay : dl->pos + dl->size - delay;
+}
+
+static inline uint32_t DL_Wrap(const DelayLine_t *dl, uint32_t idx) {
+	return (idx >= dl->size) ? idx - dl->size : idx;
+}
+
+// 읽기/쓰기 인덱스 둘 다 wrap 없이 갈 수 있는 최대 길이 (n 이하)
+static inline uint32_t DL_Span(const DelayLine_t *dl, uint32_t rd, uint32_t wr,
+		uint32_t n) {
+	uint32_t a = dl->size - rd;
+	uint32_t b = dl->size - wr;
+	if (a < n)
+		n = a;
+	if (b < n)
+		n = b;
+	return n;
+}
+
+static inline int16_t DL_Read(const DelayLine_t *dl, uint32_t delay) {
+	return dl->buf[DL_Index(dl, delay)];
+}
+
+static inline void DL_Write(DelayLine_t *dl, int16_t v) {
+	dl->buf[dl->pos] = v;
+	if (++dl->pos == dl->size)
+		dl->pos = 0;
+}
+
+// 소수 딜레이 읽기 (delay_q16: Q16 샘플 수, 정수부 1 이상 size-1 이하)
+// 인접 두 샘플 선형 보간, 결과는 -1.0 ~ 1.0 스케일
+static inline float DL_ReadFrac(const DelayLine_t *dl, uint32_t delay_q16) {
+	uint32_t i0 = DL_Index(dl, delay_q16 >> 16);
+	uint32_t i1 = (i0 == 0) ? dl->size - 1 : i0 - 1;
+	float frac = (float) (delay_q16 & 0xFFFF) * (1.0f / 65536.0f);
+	float a = (float) dl->buf[i0];
+	float b = (float) dl->buf[i1];
+	return (a + (b - a) * frac) * (1.0f / 32768.0f);
+}
+
+// float(-1.0 ~ 1.0) → int16 포화 변환
+static inline int16_t DL_ToQ15(float x) {
+	x *= 32767.0f;
+	if (x > 32767.0f)
+		x = 32767.0f;
+	if (x < -32768.0f)
+		x = -32768.0f;
+	return (int16_t) x;
+}
+
+#endif /* INC_DELAY_LINE_H_ */
@@ -0,0 +1,94 @@
+/*
+ * dsp_math.h
+ *
+ *  Cortex-M4F용 빠른 근사 함수 (single precision만 사용, powf/double 회피)
+ */
+
+#ifndef INC_DSP_MATH_H_
+#define INC_DSP_MATH_H_
+
+#include <stdint.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+typedef union {
+	float f;
+	int32_t i;
+} dsp_f32_bits_t;
+
+// 2^x 근사 (최대 오차 약 0.007 cent)
+// x = 정수부 i + 소수부 f, 2^f 는 4차 다항식, 2^i 는 지수 비트에 직접 더함
+static inline float fast_exp2f(float x) {
+	if (x < -126.0f)
+		return 0.0f;
+	if (x > 127.0f)
+		x = 127.0f;
+
+	int32_t i = (int32_t) x;
+	if (x < (float) i)
+		i--; // 음수는 내림
+	float f = x - (float) i; // 0.0 ~ 1.0
+
+	dsp_f32_bits_t u;
+	u.f = 1.0f
+			+ f * (0.69301751f
+					+ f * (0.24144866f + f * (0.05194795f + f * 0.01358166f)));
+	u.i += i << 23;
+	return u.f;
+}
+
+// log2(x) 근사, x > 0 (최대 오차 약 0.02 cent)
+// 지수 비트 + 가수부 log2(1+t) 5차 다항식
+static inline float fast_log2f(float x) {
+	dsp_f32_bits_t u;
+	u.f = x;
+	int32_t e = ((u.i >> 23) & 0xFF) - 127;
+	u.i = (u.i & 0x007FFFFF) | 0x3F800000; // 가수부만 남겨서 1.0 ~ 2.0
+	float t = u.f - 1.0f;
+
+	return (float) e
+			+ t * (1.4418799f
+					+ t * (-0.70886522f
+							+ t * (0.41524556f
+									+ t * (-0.19351653f + t * 0.04526829f))));
+}
+
+// cent → 배율 (2^(cents/1200))
+static inline float cents_to_ratio(float cents) {
+	return fast_exp2f(cents * (1.0f / 1200.0f));
+}
+
+// xorshift32 PRNG (주기 2^32-1, state는 0이 아니어야 함)
+// F411에는 하드웨어 RNG가 없으므로 소프트웨어로, 타깃/PC 모두 같은 결과
+static inline uint32_t xorshift32(uint32_t *state) {
+	uint32_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+// -1.0 ~ 1.0 균등 분포
+static inline float xorshift32_bipolar(uint32_t *state) {
+	return (float) (int32_t) xorshift32(state) * (1.0f / 2147483648.0f);
+}
+
+// int16 2개 패킹 ([15:0] = lo, [31:16] = hi)
+static inline uint32_t dsp_pack16(int16_t lo, int16_t hi) {
+	return (uint16_t) lo | ((uint32_t) (uint16_t) hi << 16);
+}
+
+// acc + x.lo * y.lo + x.hi * y.hi (Cortex-M4 SMLAD 1사이클, PC는 같은 결과의 C 코드)
+static inline int32_t dsp_smlad(uint32_t x, uint32_t y, int32_t acc) {
+#if defined(__ARM_FEATURE_DSP)
+	return __smlad(x, y, acc);
+#else
+	return acc + (int32_t) (int16_t) x * (int16_t) y
+			+ (int32_t) (int16_t) (x >> 16) * (int16_t) (y >> 16);
+#endif
+}
+
+#endif /* INC_DSP_MATH_H_ */
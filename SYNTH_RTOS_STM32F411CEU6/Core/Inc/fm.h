@@ -0,0 +1,73 @@
+/*
+ * fm.h
+ *
+ *  FM(위상 변조) 오퍼레이터 엔진 (2~4 오퍼레이터)
+ *  - DDS 위상 누산기 + sine_lut, 변조는 위상에 정수 오프셋을 더하는 방식
+ *  - 오퍼레이터별 주파수 비율 / 레벨 / 엔벨로프, 최상위 오퍼레이터 피드백
+ *  - 렌더링은 오퍼레이터 단위로 서브블록(MOD_SUBBLOCK) 한 번에 처리
+ */
+
+#ifndef INC_FM_H_
+#define INC_FM_H_
+
+#include <stdint.h>
+#include "mod.h"
+
+#define FM_NUM_OPS        4
+#define FM_INDEX_MAX      3.0f   // 레벨 1.0 변조기의 최대 위상 편이 (rad)
+#define FM_FEEDBACK_MAX   7
+#define FM_RATIO_MAX      64.0f  // 오퍼레이터 비율 상한 (Q16 으로 uint32 안에 들어가는 범위)
+
+// 알고리즘 (op1 = 0번, 번호가 큰 오퍼레이터가 작은 쪽을 변조)
+typedef enum {
+	FM_ALG_STACK = 0,    // 4 → 3 → 2 → 1
+	FM_ALG_Y,            // (3 + 4) → 2 → 1
+	FM_ALG_TWO_STACKS,   // 2 → 1, 4 → 3 (캐리어 2개)
+	FM_ALG_ONE_TO_THREE, // 4 → (1, 2, 3)
+	FM_ALG_TWO_OP,       // 2 → 1 (2 오퍼레이터)
+	FM_ALG_ADDITIVE,     // 1 + 2 + 3 + 4 (오르간)
+	FM_ALG_COUNT
+} FM_Algorithm_t;
+
+typedef struct {
+	uint32_t ratio_q16;  // 노트 주파수 대비 배율 Q16 (0.5, 1, 2, 3.5 ... → 0x8000, 0x10000 ...)
+	float level;         // 0.0 ~ 1.0 (변조기는 변조 지수, 캐리어는 출력 레벨)
+	Mod_Env_t env;       // 오퍼레이터 엔벨로프 (서브블록 단위, 보이스에 복사해서 사용)
+} FM_Operator_t;
+
+typedef struct {
+	FM_Algorithm_t algorithm;
+	uint8_t feedback;    // 0(끔) ~ FM_FEEDBACK_MAX, 최상위 오퍼레이터(op4) 자기 변조
+	FM_Operator_t op[FM_NUM_OPS];
+} FM_Patch_t;
+
+// 보이스별 FM 상태
+typedef struct {
+	uint32_t phase[FM_NUM_OPS];
+	Mod_Env_t env[FM_NUM_OPS];
+	float gain[FM_NUM_OPS];      // 현재 오퍼레이터 게인 (서브블록 내 선형 보간)
+	float gain_end[FM_NUM_OPS];  // 서브블록 끝 목표 게인
+	int32_t fb_prev[2];          // 피드백용 직전 출력 2개 (위상 단위)
+} FM_Voice_t;
+
+extern FM_Patch_t g_fm_patch;
+
+void FM_Init(void);
+void FM_SetAlgorithm(FM_Algorithm_t alg);
+void FM_SetFeedback(uint8_t fb);
+// ratio 는 0 초과 ~ FM_RATIO_MAX, 범위 밖이면 오퍼레이터를 바꾸지 않음
+void FM_SetOperator(uint8_t idx, float ratio, float level, uint16_t attack_ms,
+		uint16_t decay_ms, float sustain, uint16_t release_ms);
+
+void FM_NoteOn(FM_Voice_t *fv);
+void FM_NoteOff(FM_Voice_t *fv);
+
+// 서브블록마다 1회: 오퍼레이터 엔벨로프 진행
+void FM_Tick(FM_Voice_t *fv);
+
+// n 프레임 렌더링 → out에 누적 (word/step: 보이스 tuning word 램프)
+// 반환: 렌더링한 오퍼레이터 x 프레임 수 (성능 측정용)
+uint32_t FM_Render(FM_Voice_t *fv, uint32_t word, int32_t step, float *out,
+		int n);
+
+#endif /* INC_FM_H_ */
@@ -0,0 +1,23 @@
+/*
+ * fx_arena.h
+ *
+ *  이펙트 메모리 아레나 (정적 배열 1개 + bump 할당, 힙 사용 없음)
+ *  - 크기는 스테이지별 FX_xxx_RAM_BYTES 합으로 컴파일 타임에 결정 → .bss 에 고정
+ *  - 해제 없음: FX_Chain_Init 에서 Reset 후 스테이지 Init 이 한 번씩 할당
+ */
+
+#ifndef INC_FX_ARENA_H_
+#define INC_FX_ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+void FX_Arena_Reset(void);
+
+// 4바이트 정렬 할당, 남은 공간이 부족하면 NULL
+void* FX_Arena_Alloc(size_t bytes);
+
+size_t FX_Arena_Used(void);
+size_t FX_Arena_Size(void);
+
+#endif /* INC_FX_ARENA_H_ */
@@ -0,0 +1,49 @@
+/*
+ * fx_chain.h
+ *
+ *  포스트 믹스 이펙트 체인
+ *  - 모든 스테이지가 같은 인터페이스: 스테레오 float 블록 in-place 처리 (-1.0 ~ 1.0)
+ *  - 스테이지 순서는 고정 (drive → filter → chorus → delay → reverb → comp)
+ *  - 스테이지마다 Perf_Block_t → [PERF] 리포트에 스테이지별 사이클 / 데드라인 비율
+ *  - 딜레이 라인 메모리는 모두 fx_arena (정적, 힙 없음)
+ */
+
+#ifndef INC_FX_CHAIN_H_
+#define INC_FX_CHAIN_H_
+
+#include <stdint.h>
+#include "perf.h"
+
+typedef enum {
+	FX_STAGE_DRIVE = 0,
+	FX_STAGE_FILTER,
+	FX_STAGE_CHORUS,
+	FX_STAGE_DELAY,
+	FX_STAGE_REVERB,
+	FX_STAGE_COMP,
+	FX_STAGE_COUNT
+} FX_StageId_t;
+
+typedef struct {
+	const char *name;
+	int (*init)(void);                            // NULL 가능, 0: 성공 / -1: 실패
+	uint32_t (*process)(float *l, float *r, int n); // in-place 블록 처리, 반환: 작업량
+	const char *unit;                             // 작업량 단위 (기본 "frame")
+	volatile uint8_t *enabled;                    // NULL 이면 항상 켜짐
+	uint8_t ready;                                // init 성공 여부 (실패 시 건너뜀)
+	Perf_Block_t perf;
+} FX_Stage_t;
+
+// 아레나 리셋 후 스테이지 init (오디오 시작 전 1회)
+void FX_Chain_Init(void);
+
+// 스테이지별 성능 블록 등록 (첫 버퍼 채우기 이후, frames = 오디오 블록 프레임 수)
+void FX_Chain_PerfInit(uint32_t frames);
+
+// 서브블록 처리 (켜진 스테이지만, 스테이지마다 사이클 누적)
+void FX_Chain_Process(float *l, float *r, int n);
+
+// 오디오 블록 끝에서 1회: 스테이지별 사이클 기록
+void FX_Chain_Commit(void);
+
+#endif /* INC_FX_CHAIN_H_ */
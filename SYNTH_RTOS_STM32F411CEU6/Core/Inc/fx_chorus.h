@@ -0,0 +1,44 @@
+/*
+ * fx_chorus.h
+ *
+ *  코러스 / 플랜저 (짧은 모듈레이션 딜레이)
+ *  - sine_lut 기반 LFO, 좌우 90도 위상차 → 스테레오 폭
+ *  - 딜레이 시간은 서브블록 시작/끝 LFO 값 사이를 Q16으로 선형 램프
+ *  - 소수 샘플 선형 보간 읽기 (DL_ReadFrac)
+ */
+
+#ifndef INC_FX_CHORUS_H_
+#define INC_FX_CHORUS_H_
+
+#include <stdint.h>
+
+#define FX_CHORUS_MAX_FRAMES  1024    // 약 23ms (채널당 2 KB)
+#define FX_CHORUS_RAM_BYTES   (FX_CHORUS_MAX_FRAMES * 2u * sizeof(int16_t))
+
+typedef enum {
+	CHORUS_MODE_CHORUS = 0,   // 기본 딜레이 약 7~20ms, 피드백 없음
+	CHORUS_MODE_FLANGER,      // 기본 딜레이 약 0.5~5ms, 피드백 사용
+} Chorus_Mode_t;
+
+typedef struct {
+	uint8_t enabled;
+	Chorus_Mode_t mode;
+	float rate_hz;       // LFO 속도
+	float base_ms;       // 중심 딜레이
+	float depth_ms;      // LFO 변조 폭 (±)
+	float feedback;      // -0.9 ~ 0.9 (플랜저)
+	float mix;           // 웻 레벨 0.0 ~ 1.0
+} Chorus_Params_t;
+
+extern volatile Chorus_Params_t g_chorus;
+
+// 버퍼를 아레나에서 할당 (0: 성공, -1: 아레나 부족)
+int FX_Chorus_Init(void);
+
+// 모드 기본값 적용 (코러스 / 플랜저)
+void FX_Chorus_SetMode(Chorus_Mode_t mode);
+
+// 스테레오 블록 처리 (in-place, -1.0 ~ 1.0 스케일), 반환: 처리한 프레임 수
+uint32_t FX_Chorus_Process(float *l, float *r, int n);
+
+#endif /* INC_FX_CHORUS_H_ */
@@ -0,0 +1,33 @@
+/*
+ * fx_comp.h
+ *
+ *  마스터 버스 컴프레서 (스테레오 링크)
+ *  - 레벨 검출은 서브블록 단위: 블록 평균 제곱 → RMS 스무딩 → dB
+ *  - 게인 계산 / 어택·릴리즈도 블록당 1번, 샘플 루프는 블록 안 게인 선형 보간만
+ *  - 블록 피크 기준 천장(ceiling): 보이스가 늘어나도 Master_Out 클램프에 닿지 않게
+ */
+
+#ifndef INC_FX_COMP_H_
+#define INC_FX_COMP_H_
+
+#include <stdint.h>
+
+typedef struct {
+	uint8_t enabled;
+	float threshold_db;  // dBFS (버스 1.0 = 0 dB)
+	float ratio;         // 1.0 ~ 20.0
+	float attack_ms;
+	float release_ms;
+	float makeup_db;
+	float ceiling_db;    // 출력 피크 상한 (0 이상이면 끔)
+} Comp_Params_t;
+
+extern volatile Comp_Params_t g_comp;
+extern volatile float g_comp_gr_db;   // 현재 게인 리덕션 (dB, 미터 표시용)
+
+int FX_Comp_Init(void);
+
+// 스테레오 블록 처리 (in-place, -1.0 ~ 1.0 스케일), 반환: 처리한 프레임 수
+uint32_t FX_Comp_Process(float *l, float *r, int n);
+
+#endif /* INC_FX_COMP_H_ */
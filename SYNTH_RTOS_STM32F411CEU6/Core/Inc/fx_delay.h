@@ -0,0 +1,57 @@
+/*
+ * fx_delay.h
+ *
+ *  스테레오 피드백 딜레이 (마스터 필터 뒤)
+ *  - int16 원형 버퍼 2채널, 크기는 FX_DELAY_RAM_BYTES 예산에서 결정 (이펙트 아레나에서 할당)
+ *  - 템포 싱크(BPM + 음표 길이) 또는 ms 직접 지정
+ *  - 피드백 경로에 1극 LPF (damping) → 반복될수록 어두워짐
+ *  - 핑퐁 모드: 입력은 왼쪽으로만, 피드백은 좌우 교차
+ *  - 시간(time_ms / bpm / sync)이 바뀌면 읽기 위치를 바로 옮기지 않고 두 탭을 크로스페이드
+ */
+
+#ifndef INC_FX_DELAY_H_
+#define INC_FX_DELAY_H_
+
+#include <stdint.h>
+
+// 딜레이 버퍼 SRAM 예산 (2채널 합): 16 KB → 최대 약 92 ms (슬랩백)
+// 긴 딜레이가 필요하면 빌드 옵션으로 늘림 (-DFX_DELAY_RAM_BYTES=49152 → 약 278 ms, 전체 RAM 확인)
+#ifndef FX_DELAY_RAM_BYTES
+#define FX_DELAY_RAM_BYTES   (16u * 1024u)
+#endif
+#define FX_DELAY_MAX_FRAMES  (FX_DELAY_RAM_BYTES / (2u * sizeof(int16_t)))
+#define FX_DELAY_XFADE       1024u   // 딜레이 시간 변경 시 이전/새 탭 크로스페이드 (프레임, 약 23 ms)
+
+typedef enum {
+	DELAY_SYNC_OFF = 0,   // time_ms 사용
+	DELAY_SYNC_16TH,
+	DELAY_SYNC_8TH_TRIPLET,
+	DELAY_SYNC_8TH,
+	DELAY_SYNC_8TH_DOTTED,
+	DELAY_SYNC_QUARTER,
+	DELAY_SYNC_COUNT
+} Delay_Sync_t;
+
+typedef struct {
+	uint8_t enabled;
+	uint8_t ping_pong;
+	Delay_Sync_t sync;
+	uint16_t bpm;
+	uint16_t time_ms;     // sync == OFF 일 때
+	float feedback;       // 0.0 ~ 0.95
+	float damping;        // 0.0(밝음) ~ 1.0(어두움)
+	float mix;            // 웻 레벨 0.0 ~ 1.0
+} Delay_Params_t;
+
+extern volatile Delay_Params_t g_delay;
+
+// 버퍼를 아레나에서 할당 (0: 성공, -1: 아레나 부족)
+int FX_Delay_Init(void);
+
+// 현재 파라미터의 딜레이 길이 (프레임, 버퍼 크기로 클램프)
+uint32_t FX_Delay_Frames(void);
+
+// 스테레오 블록 처리 (in-place, -1.0 ~ 1.0 스케일), 반환: 처리한 프레임 수
+uint32_t FX_Delay_Process(float *l, float *r, int n);
+
+#endif /* INC_FX_DELAY_H_ */
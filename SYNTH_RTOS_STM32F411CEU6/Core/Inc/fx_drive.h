@@ -0,0 +1,49 @@
+/*
+ * fx_drive.h
+ *
+ *  오버샘플링 드라이브 (소프트 클리핑)
+ *  - 비선형 구간만 2x / 4x 샘플레이트에서 처리 → 나이퀴스트 위 배음이 되접히는(aliasing) 양 감소
+ *  - 업/다운 샘플링은 하프밴드 FIR 2단 (4x = 2x 단 2개 직렬)
+ *  - 타겟: CMSIS-DSP arm_fir_interpolate_f32 / arm_fir_decimate_f32 (폴리페이즈)
+ *    그 외(ARM_MATH_CM4 없음): 같은 계수로 동작하는 C 폴리페이즈 구현
+ *  - FIR 상태는 이펙트 아레나에서 할당
+ */
+
+#ifndef INC_FX_DRIVE_H_
+#define INC_FX_DRIVE_H_
+
+#include <stdint.h>
+#include "mod.h"
+
+#define DRIVE_HB1_TAPS   47   // 1x ↔ 2x 하프밴드 (4k+3, 통과대역 약 17 kHz)
+#define DRIVE_HB2_TAPS   23   // 2x ↔ 4x 하프밴드 (신호가 이미 22 kHz 아래라 짧아도 됨)
+
+// 인터폴레이터는 탭 수가 L(2)의 배수여야 해서 0 하나를 붙여서 사용
+#define DRIVE_HB1_UP_TAPS  (DRIVE_HB1_TAPS + 1)
+#define DRIVE_HB2_UP_TAPS  (DRIVE_HB2_TAPS + 1)
+
+// 채널당 FIR 상태 (CMSIS 규격: 인터폴레이터 taps/L + block - 1, 데시메이터 taps + block - 1)
+#define DRIVE_STATE_FLOATS  ( \
+	(DRIVE_HB1_UP_TAPS / 2 + MOD_SUBBLOCK - 1) + \
+	(DRIVE_HB1_TAPS + 2 * MOD_SUBBLOCK - 1) + \
+	(DRIVE_HB2_UP_TAPS / 2 + 2 * MOD_SUBBLOCK - 1) + \
+	(DRIVE_HB2_TAPS + 4 * MOD_SUBBLOCK - 1))
+#define FX_DRIVE_RAM_BYTES  (2u * DRIVE_STATE_FLOATS * sizeof(float))
+
+typedef struct {
+	uint8_t enabled;
+	uint8_t oversample;  // 1, 2, 4
+	float drive_db;      // 입력 게인 0 ~ 36 dB
+	float level;         // 출력 레벨 0.0 ~ 1.0
+} Drive_Params_t;
+
+extern volatile Drive_Params_t g_drive;
+
+// 계수 계산 + FIR 상태를 아레나에서 할당 (0: 성공, -1: 아레나 부족)
+int FX_Drive_Init(void);
+
+// 스테레오 블록 처리 (in-place, n <= MOD_SUBBLOCK)
+// 반환: 오버샘플링된 샘플 수 (n x 배율, 배율별 비용 비교용)
+uint32_t FX_Drive_Process(float *l, float *r, int n);
+
+#endif /* INC_FX_DRIVE_H_ */
@@ -0,0 +1,57 @@
+/*
+ * fx_reverb.h
+ *
+ *  알고리즘 리버브 (FDN: 피드백 딜레이 네트워크)
+ *  - 소수(prime) 길이 int16 딜레이 라인 N개 + 하다마드 행렬 피드백
+ *  - 라인마다 1극 LPF (damping), 라인 길이에 맞춘 감쇠 게인 → RT60 일정
+ *  - 입력 앞단에 올패스 디퓨저 (프리셋에 따라)
+ *  - 메모리는 프리셋으로 컴파일 타임에 고정 (REVERB_PRESET), 이펙트 아레나에서 할당
+ */
+
+#ifndef INC_FX_REVERB_H_
+#define INC_FX_REVERB_H_
+
+#include <stdint.h>
+
+// 컴파일 타임 품질/비용 프리셋
+#define REVERB_PRESET_LOW    0   // 라인 4개, 디퓨저 없음  (약 10 KB)
+#define REVERB_PRESET_MED    1   // 라인 4개, 디퓨저 2개   (약 16 KB)
+#define REVERB_PRESET_HIGH   2   // 라인 8개, 디퓨저 3개   (약 28 KB)
+
+#ifndef REVERB_PRESET
+#define REVERB_PRESET        REVERB_PRESET_MED
+#endif
+
+// 프리셋별 라인/디퓨저 길이 합 (샘플) → 아레나 요구량
+#if REVERB_PRESET == REVERB_PRESET_LOW
+#define REVERB_LINE_TOTAL    (1009 + 1201 + 1409 + 1601)
+#define REVERB_DIFF_TOTAL    0
+#elif REVERB_PRESET == REVERB_PRESET_MED
+#define REVERB_LINE_TOTAL    (1427 + 1787 + 2143 + 2503)
+#define REVERB_DIFF_TOTAL    (227 + 347)
+#elif REVERB_PRESET == REVERB_PRESET_HIGH
+#define REVERB_LINE_TOTAL    (1117 + 1277 + 1433 + 1601 + 1759 + 1931 + 2111 + 2287)
+#define REVERB_DIFF_TOTAL    (113 + 227 + 347)
+#else
+#error "unknown REVERB_PRESET"
+#endif
+
+#define FX_REVERB_RAM_BYTES  ((REVERB_LINE_TOTAL + REVERB_DIFF_TOTAL) * 2u)
+
+typedef struct {
+	uint8_t enabled;
+	float decay_s;       // RT60 (초)
+	float damping;       // 0.0(밝음) ~ 1.0(어두움)
+	float mix;           // 웻 레벨 0.0 ~ 1.0
+} Reverb_Params_t;
+
+extern volatile Reverb_Params_t g_reverb;
+
+// 라인 메모리를 아레나에서 할당 (0: 성공, -1: 아레나 부족)
+int FX_Reverb_Init(void);
+
+// 스테레오 블록 처리 (in-place, 입력은 모노로 합쳐서 넣고 출력은 스테레오)
+// 반환: 처리한 프레임 수
+uint32_t FX_Reverb_Process(float *l, float *r, int n);
+
+#endif /* INC_FX_REVERB_H_ */
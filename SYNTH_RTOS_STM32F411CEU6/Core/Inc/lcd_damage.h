@@ -0,0 +1,26 @@
+/*
+ * lcd_damage.h
+ *
+ *  손상 영역(dirty rectangle) 목록
+ *  - 바뀐 화면 영역을 사각형으로 모아 병합 → 컴포지터가 그 영역만 다시 그림
+ *  - 병합 기준: 합친 사각형의 추가 픽셀 비용 ≤ 주소 창 1번 비용 (LCD_WINDOW_BYTES)
+ *  - LCD_Task 전용 (잠금 없음)
+ */
+
+#ifndef INC_LCD_DAMAGE_H_
+#define INC_LCD_DAMAGE_H_
+
+#include "lcd_draw.h"
+
+#define DAMAGE_MAX_RECTS  12   // 가득 차면 가장 적게 커지는 쪽과 강제 병합
+
+// 사각형 추가 (좌표 순서 무관)
+void Damage_Add(int x0, int y0, int x1, int y1);
+
+// 1픽셀 테두리의 네 변만 추가 (선택 박스 이동 등, 안쪽은 그대로)
+void Damage_AddFrame(int x0, int y0, int x1, int y1);
+
+// 병합된 목록을 꺼내고 비움, 개수 반환
+int Damage_Take(LCD_Rect_t *out);
+
+#endif /* INC_LCD_DAMAGE_H_ */
@@ -0,0 +1,81 @@
+/*
+ * lcd_draw.h
+ *
+ *  LCD 그리기 레이어 (ILI9341 드라이버 위)
+ *  - 선은 주축 방향 span(가로/세로 구간)으로 래스터화 → span 마다 주소 창 1번 + 버스트 1번
+ *  - 픽셀 단위 ILI9341_Draw_Pixel(주소 창 + 2바이트)을 쓰지 않음
+ *  - 좌표는 화면 밖으로 나가도 됨 (span 단위로 클리핑)
+ *  - 클립 사각형을 설정하면 모든 그리기가 그 안으로 제한됨 (컴포지터의 손상 영역 다시 그리기)
+ */
+
+#ifndef INC_LCD_DRAW_H_
+#define INC_LCD_DRAW_H_
+
+#include <stdint.h>
+
+#define LCD_WINDOW_BYTES  11   // 주소 창 1번 비용 (2A + 4, 2B + 4, 2C) = 픽셀 5.5개
+
+// 화면 사각형 (양 끝 포함)
+typedef struct {
+	int16_t x0, y0, x1, y1;
+} LCD_Rect_t;
+
+static inline int32_t LCD_RectArea(const LCD_Rect_t *r) {
+	return (int32_t) (r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+static inline LCD_Rect_t LCD_RectUnion(const LCD_Rect_t *a, const LCD_Rect_t *b) {
+	LCD_Rect_t u = { (a->x0 < b->x0) ? a->x0 : b->x0, (a->y0 < b->y0) ? a->y0 : b->y0,
+			(a->x1 > b->x1) ? a->x1 : b->x1, (a->y1 > b->y1) ? a->y1 : b->y1 };
+	return u;
+}
+
+// 교집합이 비어 있으면 0
+int LCD_RectIntersect(const LCD_Rect_t *a, const LCD_Rect_t *b, LCD_Rect_t *out);
+
+// 클립 설정 (NULL = 화면 전체)
+void LCD_SetClip(const LCD_Rect_t *r);
+
+// 사각형 채우기 (x0 ≤ x1, y0 ≤ y1 아니어도 됨)
+void LCD_FillRect(int x0, int y0, int x1, int y1, uint16_t color);
+
+// 1픽셀 테두리 (가로/세로 span 4개)
+void LCD_DrawFrame(int x0, int y0, int x1, int y1, uint16_t color);
+
+// Bresenham 선, 같은 행(완만한 선) / 같은 열(가파른 선) 픽셀을 하나의 span 으로 묶어 전송
+void LCD_DrawLine(int x0, int y0, int x1, int y1, uint16_t color);
+
+// ===== 텍스트 (5x5_font.h, 글자 칸 6x8 x size) =====
+// - 문자열 전체 = 주소 창 1번, 행마다 글리프를 RGB565 로 펼쳐 라인 버퍼 DMA (배경 포함)
+// - 글리프는 size 배 가로 확장한 행 비트마스크로 캐시 (LCD_GLYPH_CACHE 슬롯, 직접 사상)
+// - 클립 안쪽만 전송 (글자 중간에서 잘려도 됨)
+#define LCD_TEXT_MAX_SIZE  10   // 한 행 6 x size ≤ 64비트
+#define LCD_GLYPH_CACHE    16
+
+void LCD_DrawText(const char *s, int x, int y, uint16_t fg, uint16_t bg,
+		int size);
+
+// ===== 오프스크린 타일 (2bpp 팔레트) =====
+// - 한 바이트 = 가로 4픽셀 (LSB 쪽이 왼쪽), 220x90 스코프 = 4950 바이트 (RGB565 면 39600)
+// - 전송 시 행 단위로 RGB565 로 펼쳐 라인 버퍼 DMA, 주소 창은 타일 전체에 1번
+#define LCD_TILE_STRIDE(w)   (((w) + 3) / 4)
+#define LCD_TILE_BYTES(w, h) (LCD_TILE_STRIDE(w) * (h))
+
+typedef struct {
+	uint8_t *bits;      // LCD_TILE_BYTES(w, h)
+	uint16_t w, h;      // w ≤ LCD_LINE_PIXELS
+	uint16_t stride;    // 행당 바이트
+	uint16_t pal[4];    // 팔레트 인덱스 → RGB565
+} LCD_Tile_t;
+
+void LCD_TileInit(LCD_Tile_t *t, uint8_t *bits, uint16_t w, uint16_t h);
+void LCD_TileClear(LCD_Tile_t *t, uint8_t idx);
+void LCD_TilePixel(LCD_Tile_t *t, int x, int y, uint8_t idx);
+void LCD_TileLine(LCD_Tile_t *t, int x0, int y0, int x1, int y1, uint8_t idx);
+void LCD_TileFrame(LCD_Tile_t *t, uint8_t idx);   // 가장자리 1픽셀 테두리
+
+// 타일 좌상단을 화면 (x, y) 에 전송 (화면 밖으로 나가면 전송 안 함)
+// 클립이 있으면 타일 ∩ 클립 부분만 주소 창 1번으로 전송
+void LCD_TileBlit(const LCD_Tile_t *t, int x, int y);
+
+#endif /* INC_LCD_DRAW_H_ */
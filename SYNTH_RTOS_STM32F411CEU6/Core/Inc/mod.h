@@ -0,0 +1,118 @@
+/*
+ * mod.h
+ *
+ *  모듈레이션 매트릭스 (컨트롤 레이트)
+ *  - 소스: LFO x3 (sine/tri/saw/S&H), 보조 엔벨로프(ENV2), 벨로시티, 키 트래킹, 노이즈
+ *  - 목적지: 보이스 피치(tuning_word), 필터 컷오프, 앰프, 웨이브테이블 위치
+ *  - 평가는 서브블록(MOD_SUBBLOCK 프레임)당 1회 → 샘플 루프에는 결과만 사용
+ */
+
+#ifndef INC_MOD_H_
+#define INC_MOD_H_
+
+#include <stdint.h>
+
+#define MOD_SUBBLOCK     32    // 서브블록 크기 (프레임) → 컨트롤 레이트 약 1378Hz
+#define MOD_NUM_LFOS     3
+#define MOD_NUM_SLOTS    8
+
+// LFO 파형
+typedef enum {
+	LFO_SINE = 0, LFO_TRI, LFO_SAW, LFO_SH
+} LFO_Shape_t;
+
+typedef struct {
+	LFO_Shape_t shape;
+	uint32_t phase;       // 32비트 위상 누산기 (DDS와 동일)
+	uint32_t rate_word;   // 서브블록당 위상 증가량
+	float value;          // 현재 출력 (-1.0 ~ 1.0)
+	float sh_value;       // S&H 유지값
+} Mod_LFO_t;
+
+// 모듈레이션 소스
+typedef enum {
+	MOD_SRC_NONE = 0,
+	MOD_SRC_LFO1,
+	MOD_SRC_LFO2,
+	MOD_SRC_LFO3,
+	MOD_SRC_ENV2,        // 보이스별 (0.0 ~ 1.0)
+	MOD_SRC_VELOCITY,    // 보이스별 (0.0 ~ 1.0)
+	MOD_SRC_KEYTRACK,    // 보이스별 (C4 기준 옥타브, 대략 -4 ~ +4)
+	MOD_SRC_NOISE,       // 서브블록마다 새 랜덤값 (-1.0 ~ 1.0)
+	MOD_SRC_COUNT
+} Mod_Source_t;
+
+// 모듈레이션 목적지
+typedef enum {
+	MOD_DST_PITCH = 0,   // 단위: cent
+	MOD_DST_CUTOFF,      // 단위: 옥타브
+	MOD_DST_AMP,         // 단위: 게인 (0 = 변화 없음, -1 = 무음)
+	MOD_DST_WT_POS,      // 단위: 웨이브테이블 스캔 위치 (0.0 ~ 1.0 에 더함)
+	MOD_DST_COUNT
+} Mod_Dest_t;
+
+typedef struct {
+	Mod_Source_t src;
+	Mod_Dest_t dst;
+	float amount;        // 소스 1.0 당 목적지 변화량
+} Mod_Slot_t;
+
+// 보조 엔벨로프 (서브블록 단위로 진행)
+typedef enum {
+	ENV_IDLE = 0, ENV_ATTACK, ENV_DECAY, ENV_SUSTAIN, ENV_RELEASE
+} Mod_EnvState_t;
+
+typedef struct {
+	uint16_t attack_ticks;   // 서브블록 수
+	uint16_t decay_ticks;
+	float sustain_level;
+	uint16_t release_ticks;
+
+	Mod_EnvState_t state;
+	float level;
+	float step;
+} Mod_Env_t;
+
+// 라우팅 프리셋 (# + 13 키로 순환, 슬롯 전체를 다시 씀)
+typedef enum {
+	MOD_PRESET_OFF = 0,       // 라우팅 없음 (Mod_Eval 생략)
+	MOD_PRESET_VIBRATO,       // LFO1 → 피치
+	MOD_PRESET_SWEEP,         // LFO2 → 컷오프
+	MOD_PRESET_ENV2_CUTOFF,   // ENV2 → 컷오프 (플럭)
+	MOD_PRESET_WT_SCAN,       // LFO2 → 웨이브테이블 위치 (웨이브테이블 모드 기본)
+	MOD_PRESET_COUNT
+} Mod_Preset_t;
+
+// 보이스별 소스 값 (sound_engine에서 채워서 넘김)
+typedef struct {
+	float env2;
+	float velocity;
+	float keytrack;
+} Mod_VoiceSrc_t;
+
+extern Mod_LFO_t g_mod_lfo[MOD_NUM_LFOS];
+extern Mod_Slot_t g_mod_slots[MOD_NUM_SLOTS];
+extern Mod_Env_t g_mod_env2_preset;
+extern volatile Mod_Preset_t g_mod_preset;
+
+void Mod_Init(void);
+// rate_hz 는 0 ~ 컨트롤 레이트의 절반 미만으로 클램프
+void Mod_SetLFO(uint8_t idx, LFO_Shape_t shape, float rate_hz);
+// src/dst 가 범위 밖이면 슬롯을 바꾸지 않음
+void Mod_SetSlot(uint8_t idx, Mod_Source_t src, Mod_Dest_t dst, float amount);
+// 범위 밖이면 MOD_PRESET_OFF
+void Mod_SetPreset(Mod_Preset_t preset);
+// 소스가 있고 amount != 0 인 슬롯이 하나라도 있으면 1
+uint8_t Mod_Active(void);
+
+// 서브블록마다 1회: 전역 소스(LFO) 진행
+void Mod_Tick(void);
+
+// 보조 엔벨로프
+void Mod_EnvGate(Mod_Env_t *env, uint8_t on);
+void Mod_EnvTick(Mod_Env_t *env);
+
+// 보이스 하나의 목적지 값 계산 (전역 + 보이스별 소스 합산)
+void Mod_Eval(const Mod_VoiceSrc_t *vs, float out[MOD_DST_COUNT]);
+
+#endif /* INC_MOD_H_ */
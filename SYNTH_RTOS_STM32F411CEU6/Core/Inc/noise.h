@@ -0,0 +1,32 @@
+/*
+ * noise.h
+ *
+ *  노이즈 오실레이터 (화이트 / 핑크)
+ *  - xorshift32 PRNG (dsp_math.h), 핑크는 Paul Kellet 3극 필터 (economy 버전)
+ *  - 블록 단위 렌더링 (분기 없는 루프), 보이스마다 상태를 따로 둠
+ */
+
+#ifndef INC_NOISE_H_
+#define INC_NOISE_H_
+
+#include <stdint.h>
+
+typedef enum {
+	NOISE_OFF = 0, NOISE_WHITE, NOISE_PINK, NOISE_TYPE_COUNT
+} NoiseType_t;
+
+typedef struct {
+	uint32_t seed;       // xorshift32 상태 (0 금지)
+	float b0, b1, b2;    // 핑크 필터 상태
+} Noise_t;
+
+extern volatile NoiseType_t g_noise_type;
+extern volatile float g_noise_level;   // 오실레이터 대비 노이즈 레벨 0.0 ~ 1.0
+
+void Noise_Init(Noise_t *ns, uint32_t seed);
+
+// n 샘플을 out에 누적 (gain: 출력 피크 근사, LUT 단위)
+void Noise_White(Noise_t *ns, float *out, int n, float gain);
+void Noise_Pink(Noise_t *ns, float *out, int n, float gain);
+
+#endif /* INC_NOISE_H_ */
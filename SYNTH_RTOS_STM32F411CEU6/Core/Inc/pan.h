@@ -0,0 +1,41 @@
+/*
+ * pan.h
+ *
+ *  등전력(constant-power) 팬 테이블
+ *  - PAN_STEPS 단계로 양자화, 엔트리 하나에 L/R 게인 Q14 2개를 패킹 (32비트 로드 1번)
+ *  - 센터 = 1.0 (0 dB, 기존 모노 복제와 같은 레벨), 끝 = 1.414 / 0
+ *  - 패킹 형식이 SMLAD 피연산자와 같아서 오실레이터 2개 믹스에 바로 사용
+ */
+
+#ifndef INC_PAN_H_
+#define INC_PAN_H_
+
+#include <stdint.h>
+
+#define PAN_STEPS    65    // 0 = L, PAN_CENTER = C, 64 = R
+#define PAN_CENTER   32
+#define PAN_Q        14    // 게인 고정소수점 (1.0 = 16384)
+
+extern uint32_t g_pan_lut[PAN_STEPS];   // [15:0] = L, [31:16] = R
+
+void Pan_Init(void);
+
+// 센터 기준 오프셋(-PAN_CENTER ~ PAN_CENTER, 범위 밖은 클램프) → 패킹된 L/R 게인
+static inline uint32_t Pan_Gains(int offset) {
+	int idx = offset + PAN_CENTER;
+	if (idx < 0)
+		idx = 0;
+	if (idx > PAN_STEPS - 1)
+		idx = PAN_STEPS - 1;
+	return g_pan_lut[idx];
+}
+
+static inline float Pan_L(uint32_t g) {
+	return (float) (int16_t) (g & 0xFFFFu) * (1.0f / (float) (1 << PAN_Q));
+}
+
+static inline float Pan_R(uint32_t g) {
+	return (float) (int16_t) (g >> 16) * (1.0f / (float) (1 << PAN_Q));
+}
+
+#endif /* INC_PAN_H_ */
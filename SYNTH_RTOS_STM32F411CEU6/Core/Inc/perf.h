@@ -0,0 +1,56 @@
+/*
+ * perf.h
+ *
+ *  DWT 사이클 카운터 기반 성능 측정 (오디오 블록 데드라인 텔레메트리)
+ */
+
+#ifndef INC_PERF_H_
+#define INC_PERF_H_
+
+#include "main.h"
+
+#define PERF_MAX_BLOCKS  12   // Perf_BlockInit 으로 등록할 수 있는 최대 블록 수
+
+typedef struct {
+	const char *name;
+	uint32_t frames;       // 블록당 샘플(프레임) 수
+	uint32_t budget;       // 데드라인 (사이클) = frames * HCLK / Fs
+	uint32_t last;         // 마지막 블록 사이클
+	uint32_t max;          // 리포트 구간 내 최대 사이클 (tail-decay 스파이크 확인용)
+	uint32_t sum;          // 리포트 구간 누적 (평균 계산용)
+	uint32_t count;        // 리포트 구간 블록 수
+	uint32_t overruns;     // budget 초과 횟수 (누적)
+	uint32_t units;        // 리포트 구간 누적 작업량 (예: 오실레이터 x 프레임)
+	const char *unit;      // 작업량 단위 이름 (리포트용, 예: "osc")
+	uint32_t acc_cycles;   // 블록 안에서 여러 번 나눠 측정할 때 누적 (Perf_BlockAccum)
+	uint32_t acc_units;
+} Perf_Block_t;
+
+extern Perf_Block_t g_perf_audio;
+extern Perf_Block_t g_perf_noise;
+extern Perf_Block_t g_perf_mix;
+
+void Perf_Init(void);
+
+// 초기화 + 리포트 목록에 등록 (이펙트 스테이지 등 블록이 늘어나도 Perf_Report 수정 불필요)
+void Perf_BlockInit(Perf_Block_t *p, const char *name, uint32_t frames);
+void Perf_BlockUpdate(Perf_Block_t *p, uint32_t cycles);
+// 작업량(units)도 함께 기록 → 단위당 사이클, 데드라인 내 최대 개수 추정
+void Perf_BlockUpdateUnits(Perf_Block_t *p, uint32_t cycles, uint32_t units);
+void Perf_BlockSetUnit(Perf_Block_t *p, const char *unit);
+
+// 서브블록마다 누적 → 오디오 블록 끝에서 Commit (누적 작업량이 0이면 기록 안 함)
+static inline void Perf_BlockAccum(Perf_Block_t *p, uint32_t cycles,
+		uint32_t units) {
+	p->acc_cycles += cycles;
+	p->acc_units += units;
+}
+void Perf_BlockCommit(Perf_Block_t *p);
+void Perf_Report(void);
+
+// 현재 사이클 값 (32비트, 100MHz 기준 약 42초마다 wrap → 차이 계산은 unsigned 뺄셈으로)
+static inline uint32_t Perf_Now(void) {
+	return DWT->CYCCNT;
+}
+
+#endif /* INC_PERF_H_ */
@@ -0,0 +1,44 @@
+/*
+ * scope.h
+ *
+ *  파형 스코프 캡처 (오디오 태스크 → LCD_Task)
+ *  - 트리거: 레벨 + 기울기 (히스테리시스로 잡음 재트리거 방지), 일정 시간 없으면 자동 시작
+ *  - 트리거 샘플부터 열당 timebase 샘플씩 min/max 로 묶음 (피크 검출 → 낮은 음도 한 주기 전체)
+ *  - 캡처 버퍼 2개: UI 가 가져간 버퍼는 다음 Scope_Acquire 까지 UI 전용,
+ *    오디오는 반대쪽에만 쓰고 다 채우면 인덱스 교체로 공개
+ *  - 오디오 쪽 비용: UI 가 이전 캡처를 가져간 뒤에만, 샘플당 비교 몇 번 (블록 복사 수준)
+ */
+
+#ifndef INC_SCOPE_H_
+#define INC_SCOPE_H_
+
+#include <stdint.h>
+
+#define SCOPE_COLS         218     // 파형 그래프 안쪽 폭 (ui.c WAVE_W - 2)
+#define SCOPE_SPP_MAX      64      // 열당 최대 샘플 (218 x 64 ≈ 316 ms)
+#define SCOPE_TRIG_HYST    256     // 트리거 재무장 히스테리시스
+#define SCOPE_AUTO_MIN     2205    // 자동 트리거 최소 대기 (50 ms, 20 Hz 한 주기)
+
+typedef enum {
+	SCOPE_SLOPE_RISE = 0,
+	SCOPE_SLOPE_FALL
+} Scope_Slope_t;
+
+typedef struct {
+	int16_t lo[SCOPE_COLS];    // 열별 최소
+	int16_t hi[SCOPE_COLS];    // 열별 최대
+	uint16_t spp;              // 이 캡처의 열당 샘플
+	uint8_t triggered;         // 0 = 트리거 없이 자동 시작
+} Scope_Capture_t;
+
+// 설정 (다음 캡처 시작 때 반영)
+void Scope_SetTrigger(int16_t level, Scope_Slope_t slope);
+void Scope_SetTimebase(uint16_t samples_per_col);   // 1 ~ SCOPE_SPP_MAX
+
+// 오디오 태스크: 스테레오 블록 → (L + R) / 2, 캡처가 다 차면 UI_EVT_WAVE 알림
+void Scope_Feed(const int16_t *stereo, int frames);
+
+// LCD_Task: 새 캡처가 있으면 반환 (없으면 NULL), 이전에 가져간 버퍼는 오디오에 반납
+const Scope_Capture_t* Scope_Acquire(void);
+
+#endif /* INC_SCOPE_H_ */
@@ -0,0 +1,45 @@
+/*
+ * spectrum.h
+ *
+ *  스펙트럼 분석기 (출력 신호의 로그 주파수 막대)
+ *  - 오디오 태스크 → 잠금 없는 링 버퍼 (생산자 1 / 소비자 1, 공유 변수는 쓰기 위치뿐)
+ *  - 낮은 우선순위 태스크에서 Hann 창 + 실수 FFT (arm_cfft_f32 N/2 점 + 분리, 버퍼 1개로 제자리)
+ *    50% 겹친 프레임 SPEC_AVG 개의 밴드 파워를 평균 → 막대 높이 (떨어질 때는 천천히)
+ *  - 결과는 시퀀스 번호로 보호한 스냅샷 (LCD_Task 가 읽음, 찢어진 읽기는 버림)
+ *  - 오디오 태스크(우선순위 52)보다 훨씬 낮아서 오디오 블록을 선점하지 않음
+ *    → Perf_Report 의 audio overruns 가 화면 전환 전후로 같아야 함, "fft" 블록은 홉당 사이클
+ */
+
+#ifndef INC_SPECTRUM_H_
+#define INC_SPECTRUM_H_
+
+#include <stdint.h>
+
+#define SPEC_FFT_SIZE   1024                  // 43 Hz/빈 @ 44.1 kHz
+#define SPEC_HOP        (SPEC_FFT_SIZE / 2)   // 50% 겹침
+#define SPEC_RING_SIZE  2048                  // 2의 거듭제곱, 오디오 블록(1024) + FFT 창
+#define SPEC_AVG        4                     // 스냅샷 1개 = 4 프레임 평균 (약 46 ms)
+
+#define SPEC_BANDS      44                    // 로그 간격 밴드 (막대 5픽셀 x 44 = 220)
+#define SPEC_F_MIN      40.0f
+#define SPEC_F_MAX      16000.0f
+#define SPEC_DB_RANGE   60.0f                 // 0 dBFS ~ -60 dBFS → 레벨 255 ~ 0
+#define SPEC_FALL       8                     // 스냅샷마다 막대가 내려가는 최대 레벨
+
+typedef struct {
+	uint8_t level[SPEC_BANDS];   // 0 ~ 255
+} Spectrum_Snapshot_t;
+
+// 태스크 생성 (정적 할당, FreeRTOS 힙은 기존 태스크로 거의 가득 참)
+void Spectrum_Init(void);
+
+// 분석 켜기/끄기 (스펙트럼 화면일 때만, 꺼져 있으면 Feed 도 바로 반환)
+void Spectrum_Enable(uint8_t on);
+
+// 오디오 태스크: 스테레오 블록 → (L + R) / 2 를 링 버퍼에 쓰고 분석 태스크 깨움
+void Spectrum_Feed(const int16_t *stereo, int frames);
+
+// 마지막으로 읽은 뒤 새 스냅샷이 있으면 복사하고 1 (seq 는 호출자가 보관)
+int Spectrum_Read(Spectrum_Snapshot_t *out, uint32_t *seq);
+
+#endif /* INC_SPECTRUM_H_ */
@@ -0,0 +1,39 @@
+/*
+ * tuning.h
+ *
+ *  음정 테이블 (MIDI 노트 0~127 → DDS tuning word)
+ *  - 기본은 12평균율 (A4 = 440Hz)
+ *  - Scala(.scl) 형식 문자열을 읽어서 마이크로튜닝 적용 가능
+ *  - 테이블은 로드 시 1회만 계산 → NoteOn은 배열 조회 1번
+ */
+
+#ifndef INC_TUNING_H_
+#define INC_TUNING_H_
+
+#include <stdint.h>
+
+#define TUNING_NUM_NOTES    128
+#define TUNING_MAX_DEGREES  128       // .scl 한 주기 최대 음 수
+#define TUNING_REF_NOTE     60        // 스케일 0번 음 (C4)
+#define TUNING_A4_FREQ      440.0f
+
+#define NOTE_C4             60
+
+extern uint32_t g_tuning_words[TUNING_NUM_NOTES];
+
+// 12평균율로 테이블 초기화
+void Tuning_Init(void);
+
+// Scala 형식 문자열 로드 (성공 0, 형식 오류 -1 → 기존 테이블 유지)
+//   ! 주석
+//   설명 한 줄
+//   음 개수 N
+//   N줄: "701.955" (cent, 소수점 포함) 또는 "3/2", "2" (비율)
+//   마지막 값이 주기 (보통 2/1)
+int Tuning_LoadScala(const char *scl);
+
+static inline uint32_t Tuning_Word(uint8_t note) {
+	return g_tuning_words[note & (TUNING_NUM_NOTES - 1)];
+}
+
+#endif /* INC_TUNING_H_ */
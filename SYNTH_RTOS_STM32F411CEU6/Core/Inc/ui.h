@@ -10,22 +10,12 @@
 #include "queue.h"
 #include "task.h"
 
-// ===== Dirty Flags 구조체 =====
-typedef struct {
-    uint8_t full_redraw;       // 전체 화면 다시 그리기
-    uint8_t adsr_graph;        // ADSR 그래프만
-    uint8_t adsr_sel;          // ADSR 선택 강조만
-    uint8_t wave_graph;        // 파형 그래프만
-    uint8_t filter_sel;        // 필터 선택 강조만
-    uint8_t note_display;      // 음계 표시만
-    uint8_t volume_bar;        // 볼륨 바만
-} UI_DirtyFlags_t;
-
 // LCD 상태
 typedef enum {
     LCD_STATE_INIT = 0,
     LCD_STATE_MAIN_DASH,
-    LCD_STATE_GRAPH_VIEW
+    LCD_STATE_GRAPH_VIEW,
+    LCD_STATE_SPECTRUM_VIEW     // 출력 스펙트럼 (spectrum.h), Rotary2 버튼으로 전환
 } LcdState_t;
 
 // ADSR 파라미터
@@ -47,7 +37,8 @@ typedef enum {
 typedef enum {
     UI_EDIT_ADSR = 0,
     UI_EDIT_FILTER,
-    UI_EDIT_VOLUME
+    UI_EDIT_VOLUME,
+    UI_EDIT_SCOPE          // 그래프 화면 스코프 (시간축 / 트리거)
 } UI_EditMode_t;
 
 // ADSR 선택
@@ -64,31 +55,68 @@ typedef enum {
     FILTER_SEL_RESO
 } UI_Filter_Select_t;
 
-// [추가] 시각화용 버퍼 사이즈 (화면 너비와 비슷하게)
-#define VIS_BUF_SIZE 240
+// 스코프 선택
+typedef enum {
+    SCOPE_SEL_TIME = 0,    // 열당 샘플 (x2 / ÷2)
+    SCOPE_SEL_LEVEL,       // 트리거 레벨 (점선 위치)
+    SCOPE_SEL_SLOPE        // 상승 / 하강
+} UI_Scope_Select_t;
+
+// 화면 영역 렌더링 측정 (합성 + 전송, DMA 대기 포함)
+typedef struct {
+    uint32_t cycles;       // 마지막 프레임 사이클
+    uint32_t max_cycles;
+    uint32_t bytes;        // 마지막 프레임 SPI 바이트
+    uint32_t frames;
+} UI_FrameStats_t;
+
+// LCD_Task 통계 (1초마다 갱신, 아무 일 없어도 1초에 한 번은 깨어나 갱신)
+typedef struct {
+    uint32_t wakeups;          // 초당 깨어난 횟수
+    uint32_t frames;           // 초당 그린 프레임
+    uint32_t load_permille;    // 깨어나서 그리기를 끝낼 때까지 시간 비율 (‰, DMA 대기 포함 → 상한값)
+    uint32_t px;               // 초당 전송 픽셀
+    uint32_t latency_us_last;  // 입력 이벤트 → 해당 프레임 전송 완료
+    uint32_t latency_us_max;   // 리포트 구간 최대
+} UI_LcdStats_t;
+
+// LCD_Task 이벤트 (태스크 알림 비트)
+#define UI_EVT_MODEL    (1u << 0)   // 편집 값 변경 (로터리, 버튼, EXTI)
+#define UI_EVT_WAVE     (1u << 1)   // 새 파형 캡처 (오디오 태스크)
+#define UI_EVT_SCREEN   (1u << 2)   // 화면 전환 요청 (lcdQueueHandle)
+#define UI_EVT_SPECTRUM (1u << 3)   // 새 스펙트럼 스냅샷 (분석 태스크)
+
+// 프레임 거버너
+#define UI_FPS_MAX      30          // 편집 반응 최대 프레임 (이벤트는 다음 프레임 슬롯까지 모음)
+#define UI_SCOPE_FPS    12          // 파형 스코프 / 스펙트럼 최대 갱신율
 
 // 전역 변수
 extern TaskHandle_t lcdTaskHandle;
 extern QueueHandle_t lcdQueueHandle;
 extern LcdState_t currentLcdState;
 
-extern volatile UI_DirtyFlags_t g_ui_dirty;
+// 화면 갱신: LCD_Task 가 위젯 상태를 비교해 손상 영역만 다시 그림 (lcd_damage.h)
+// 값을 바꾼 쪽은 UI_Notify 로 깨우기만 하면 됨
 extern volatile UI_ADSR_t g_ui_adsr;
 extern volatile UI_Wave_t g_ui_wave;
 extern volatile UI_EditMode_t g_ui_edit_mode;
 extern volatile UI_ADSR_Select_t g_adsr_sel;
 extern volatile UI_Filter_Select_t g_filter_sel;
+extern volatile UI_Scope_Select_t g_scope_sel;
 
 extern volatile uint8_t g_ui_note;
 extern volatile uint8_t g_ui_oct;
 extern volatile uint8_t g_ui_vol;
 extern volatile uint8_t g_ui_cutoff;
 extern volatile uint8_t g_ui_reso;
+extern volatile uint16_t g_ui_scope_spp;
+extern volatile int16_t g_ui_scope_level;
+extern volatile uint8_t g_ui_scope_fall;     // 0 = 상승, 1 = 하강
 
-//extern uint8_t sin_samples[1024];
+extern volatile UI_FrameStats_t g_ui_scope_stats;   // 파형 스코프 타일
+extern volatile UI_LcdStats_t g_ui_lcd_stats;
 
-// [추가] 사운드 엔진이 채우고, UI가 읽을 버퍼
-extern volatile int16_t g_vis_buffer[VIS_BUF_SIZE];
+//extern uint8_t sin_samples[1024];
 
 // 함수 선언
 void display_init(void);
@@ -97,4 +125,9 @@ void UI_OnEncoderDelta(int delta);
 void UI_OnChangeVolume(int delta);    // Rotary 2 (Volume)
 void UI_OnChangeOctave(int delta);    // 버튼용 (Octave)
 
+// LCD_Task 깨우기 (UI_EVT_* 비트, 태스크/ISR 어디서나 호출 가능)
+void UI_Notify(uint32_t evt);
+// 화면 전환 요청 (lcdQueueHandle 전송 + 알림, ISR 에서도 호출 가능)
+void UI_RequestScreen(LcdState_t state);
+
 #endif /* INC_UI_H_ */
@@ -14,21 +14,10 @@
 #define BUFFER_SIZE   4096 // 사실 상 2048
 #define LUT_SIZE      1024
 #define LUT_SHIFT     (32 - 10)
+#define LUT_AMPLITUDE 7000 // LUT 최대값 (이론 상 최고는 32,767)
 
 #define MAX_VOICES    3
-
-// 주파수 설정
-#define FREQ_C4       261.63f
-#define FREQ_D4       293.66f
-#define FREQ_E4       329.63f
-#define FREQ_F4       349.23f
-#define FREQ_G4       392.00f
-#define FREQ_A4       440.00f
-#define FREQ_B4       493.88f
-
-extern double freq_list[];
-
-extern volatile float target_freq;
+#define UNISON_MAX    7    // 유니즌 모드 보이스당 최대 오실레이터 수
 
 extern int16_t *current_lut;
 extern int16_t sine_lut[LUT_SIZE];
@@ -48,15 +37,35 @@ typedef struct {
 	float y1, y2;
 } Biquad;
 
+// Transposed Direct Form II (상태 2개)
+typedef struct {
+	// normalized coefficients (a0 == 1)
+	float b0, b1, b2;
+	float a1, a2;
+
+	// state (TDF-II)
+	float s1, s2;
+} BiquadTDF2;
+
 void biquad_reset(Biquad *q);
 void biquad_set_lpf(Biquad *q, float Fs, float Fc, float Q);
 float biquad_process(Biquad *q, float x);
+
+void biquad_tdf2_reset(BiquadTDF2 *q);
+void biquad_tdf2_set_lpf(BiquadTDF2 *q, float Fs, float Fc, float Q);
+float biquad_tdf2_process(BiquadTDF2 *q, float x);
+
+// 디노멀 방지: FPSCR FZ(flush-to-zero) 설정, 오디오 태스크 시작 시 1회 호출
+void biquad_enable_flush_to_zero(void);
 extern volatile uint8_t g_lpf_dirty;   // 파라미터 바뀜 플래그
 extern volatile uint8_t KEY;
 
 extern volatile float g_lpf_Q;
 extern volatile float g_lpf_FC;
 
+// 마스터 LPF (좌우 채널), 이펙트 체인의 "filter" 스테이지 (sound_engine.c)
+uint32_t Synth_Filter_Process(float *l, float *r, int n);
+
 typedef enum {
 	EVT_ENC_AB = 0, EVT_BTN_EDGE = 1,
 } evt_type_t;
@@ -68,9 +77,63 @@ extern void RotaryTasks_Init(void);
 extern void InitTasks(void);
 extern void Test(void);
 extern void KeypadTasks_Init(void);
-extern void NoteOn(void);
+// KeyScan 과 같은 printf 뮤텍스 (다른 태스크의 출력이 줄 중간에 섞이지 않게)
+extern void Printf_Lock(void);
+extern void Printf_Unlock(void);
+extern void NoteOn(uint8_t note); // MIDI 노트 번호 (60 = C4)
 extern void NoteOff(void);
 
+// 글라이드(포르타멘토) / 피치 벤드
+typedef enum {
+	GLIDE_OFF = 0,  // 글라이드 없음
+	GLIDE_LEGATO,   // 다른 키를 누르고 있을 때만 글라이드
+	GLIDE_ALWAYS,   // 항상 직전 음에서 글라이드
+	GLIDE_MODE_COUNT
+} GlideMode_t;
+
+#define PITCH_BEND_RANGE_CENTS  200  // 벤드 최대폭 (±2 반음)
+
+extern volatile GlideMode_t g_glide_mode;
+extern volatile uint16_t g_glide_ms;      // 글라이드 시간 (음 간격과 무관하게 일정)
+extern volatile int16_t g_pitch_bend;     // -8192 ~ 8191 (MIDI 14비트 중앙 0)
+
+void Synth_SetGlide(GlideMode_t mode, uint16_t time_ms);
+void Synth_SetPitchBend(int16_t value);
+
+// 보이스 모드: 폴리(보이스당 오실레이터 1개) / 유니즌(디튠된 N개 + 스테레오 스프레드)
+//             / FM(2~4 오퍼레이터, fm.h 패치) / 웨이브테이블(wavetable.h)
+typedef enum {
+	VOICE_MODE_POLY = 0,
+	VOICE_MODE_UNISON,
+	VOICE_MODE_FM,
+	VOICE_MODE_WAVETABLE,
+	VOICE_MODE_COUNT
+} VoiceMode_t;
+
+extern volatile VoiceMode_t g_voice_mode;
+extern volatile uint8_t g_unison_count;   // 1 ~ UNISON_MAX
+extern volatile float g_unison_detune;    // 가장 바깥 오실레이터 디튠 (cent)
+extern volatile float g_unison_spread;    // 스테레오 폭 0.0 ~ 1.0
+
+void Synth_SetVoiceMode(VoiceMode_t mode);
+void Synth_SetUnison(uint8_t count, float detune_cents, float spread);
+
+// 보이스 팬: 보이스별 고정 팬 + 스프레드 모드 (NoteOn 때 결정, pan.h 등전력 테이블)
+typedef enum {
+	PAN_SPREAD_OFF = 0,    // 보이스별 팬 값만 사용
+	PAN_SPREAD_VOICE,      // 보이스 슬롯 순서대로 좌 → 우 균등 배치
+	PAN_SPREAD_KEY,        // 노트 높이 따라 (C4 센터, ±2옥타브에서 끝)
+	PAN_SPREAD_RANDOM,     // 노트마다 랜덤
+	PAN_SPREAD_COUNT
+} PanSpread_t;
+
+extern volatile int8_t g_voice_pan[MAX_VOICES];  // -32(L) ~ 32(R)
+extern volatile PanSpread_t g_pan_spread;
+extern volatile float g_pan_spread_amt;          // 스프레드 폭 0.0 ~ 1.0
+
+void Synth_SetPan(uint8_t voice, int8_t pan);
+void Synth_SetPanSpread(PanSpread_t mode, float amount);
+
 // ui
 extern volatile int32_t g_enc_pos[2];
 
@@ -0,0 +1,39 @@
+/*
+ * wavetable.h
+ *
+ *  웨이브테이블 오실레이터 (플래시에 저장된 여러 프레임 사이를 모핑)
+ *  - 프레임 = 단일 주기 파형 WT_FRAME_SIZE 샘플 (int16)
+ *  - 스캔 위치는 Q16 고정소수점 (정수부 = 프레임 번호, 소수부 = 다음 프레임 비율)
+ *  - 인접 프레임 크로스페이드는 정수 보간 (곱셈 1번 + 시프트)
+ *  - 테이블 데이터는 Tools/wav2wt.c 로 WAV 파일에서 생성
+ */
+
+#ifndef INC_WAVETABLE_H_
+#define INC_WAVETABLE_H_
+
+#include <stdint.h>
+
+#define WT_FRAME_BITS   8
+#define WT_FRAME_SIZE   (1 << WT_FRAME_BITS)   // 256 샘플/프레임
+#define WT_SHIFT        (32 - WT_FRAME_BITS)
+
+typedef struct {
+	const int16_t *data;     // num_frames * WT_FRAME_SIZE (프레임 순서대로)
+	uint16_t num_frames;     // 2 이상 (보간 시 다음 프레임을 항상 읽음)
+} Wavetable_t;
+
+// 기본 테이블 (wavetable_data.c, 사인 → 톱니 → 사각 모핑)
+extern const Wavetable_t g_wt_default;
+
+extern const Wavetable_t *g_wavetable;   // 현재 사용 테이블
+extern volatile float g_wt_position;     // 기본 스캔 위치 0.0 ~ 1.0
+
+// 스캔 위치(0.0 ~ 1.0) → Q16 프레임 위치 (마지막 프레임 직전에서 클램프)
+uint32_t WT_PosToQ16(const Wavetable_t *wt, float pos);
+
+// n 프레임 렌더링 → out에 누적
+// word/step: tuning word 램프, pos/pos_step: Q16 스캔 위치 램프
+void WT_Render(const Wavetable_t *wt, uint32_t *phase, uint32_t word,
+		int32_t step, uint32_t pos, int32_t pos_step, float *out, int n);
+
+#endif /* INC_WAVETABLE_H_ */
@@ -81,25 +81,179 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "ILI9341_STM32_Driver.h"
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "task.h"
 
 /* Global Variables ------------------------------------------------------------------*/
 volatile uint16_t LCD_HEIGHT = ILI9341_SCREEN_HEIGHT;
 volatile uint16_t LCD_WIDTH = ILI9341_SCREEN_WIDTH;
 
+volatile LCD_SPI_Stats_t g_lcd_spi_stats;
+
+// DMA 전송 상태
+// - 한 번에 DMA 1건만 진행, 완료는 HAL_SPI_TxCpltCallback → spi_done 세마포어
+// - DC/CS 를 바꾸기 전에는 항상 spi_wait() 로 진행 중인 전송을 끝냄 (CS 레이스 방지)
+static StaticSemaphore_t spi_done_buf;
+static SemaphoreHandle_t spi_done;
+static volatile uint8_t spi_busy;
+static const void *spi_buf; // 진행 중인 DMA 의 소스 버퍼
+
+// 라인 버퍼 2개 (ILI9341_LineColour 값), 하나를 DMA 로 보내는 동안 다른 하나를 채움
+static uint16_t lcd_line[2][LCD_LINE_PIXELS];
+static uint8_t line_next;
+
+// 클럭 프로파일 → 분주비 (SPI2 = APB1)
+static const uint32_t spi_prescaler[LCD_SPI_PROFILE_COUNT] = {
+SPI_BAUDRATEPRESCALER_8, SPI_BAUDRATEPRESCALER_4, SPI_BAUDRATEPRESCALER_2 };
+static LCD_SPI_Profile_t spi_profile = LCD_SPI_FAST; // MX_SPI2_Init 설정 (/2)
+
+static int spi_can_dma(void) {
+	// 스케줄러 시작 전(ILI9341_Init)에는 세마포어 대기가 불가능 → 폴링
+	return spi_done != NULL
+			&& xTaskGetSchedulerState() == taskSCHEDULER_RUNNING;
+}
+
+// 진행 중인 DMA 전송 완료까지 대기 (대기 중에는 다른 태스크 실행)
+static void spi_wait(void) {
+	if (!spi_busy)
+		return;
+	if (xSemaphoreTake(spi_done, pdMS_TO_TICKS(LCD_SPI_TIMEOUT_MS)) != pdTRUE) {
+		HAL_SPI_Abort(HSPI_INSTANCE);
+		g_lcd_spi_stats.timeouts++;
+	}
+	spi_busy = 0;
+}
+
+// SPI 프레임 크기 / 분주비 변경 (바뀔 때만, 진행 중인 전송은 먼저 끝냄)
+// - CR1 의 DFF/BR 은 SPI 를 끈 상태에서만 변경 가능, 다음 HAL 전송이 다시 켬
+// - DMA 스트림의 메모리/주변장치 폭도 프레임 크기에 맞춤 (전송 개수 = 프레임 수)
+static void spi_config(uint32_t datasize, uint32_t prescaler) {
+	SPI_HandleTypeDef *h = HSPI_INSTANCE;
+	if (h->Init.DataSize == datasize && h->Init.BaudRatePrescaler == prescaler)
+		return;
+
+	spi_wait();
+	__HAL_SPI_DISABLE(h);
+	MODIFY_REG(h->Instance->CR1, SPI_CR1_DFF | SPI_CR1_BR, datasize | prescaler);
+	h->Init.DataSize = datasize;
+	h->Init.BaudRatePrescaler = prescaler;
+
+	if (h->hdmatx != NULL) {
+		const uint8_t half = (datasize == SPI_DATASIZE_16BIT);
+		h->hdmatx->Init.PeriphDataAlignment =
+				half ? DMA_PDATAALIGN_HALFWORD : DMA_PDATAALIGN_BYTE;
+		h->hdmatx->Init.MemDataAlignment =
+				half ? DMA_MDATAALIGN_HALFWORD : DMA_MDATAALIGN_BYTE;
+		MODIFY_REG(h->hdmatx->Instance->CR, DMA_SxCR_PSIZE | DMA_SxCR_MSIZE,
+				h->hdmatx->Init.PeriphDataAlignment
+						| h->hdmatx->Init.MemDataAlignment);
+	}
+	g_lcd_spi_stats.reconfigs++;
+}
+
+// 전송 시작 (이전 전송은 먼저 끝냄), n = SPI 프레임 수, bytes = 실제 바이트
+// - 짧은 전송 / 스케줄러 전: 폴링, 반환 시점에 완료
+// - 그 외: DMA 시작 후 바로 반환, buf 는 다음 spi_wait() 까지 유지되어야 함
+static void spi_xfer(const void *buf, uint16_t n, uint32_t bytes) {
+	spi_wait();
+	if (n == 0)
+		return;
+	g_lcd_spi_stats.bytes += bytes;
+
+	if (bytes >= LCD_DMA_MIN_BYTES && spi_can_dma()) {
+		spi_busy = 1;
+		spi_buf = buf;
+		if (HAL_SPI_Transmit_DMA(HSPI_INSTANCE, (uint8_t*) buf, n) == HAL_OK) {
+			g_lcd_spi_stats.dma_xfers++;
+			return;
+		}
+		spi_busy = 0;
+	}
+	g_lcd_spi_stats.poll_xfers++;
+	HAL_SPI_Transmit(HSPI_INSTANCE, (uint8_t*) buf, n, LCD_SPI_TIMEOUT_MS);
+}
+
+// 바이트 스트림 (명령/좌표/호출자 버퍼): 항상 8비트 프레임
+static void spi_send(const uint8_t *buf, uint16_t len) {
+	spi_config(SPI_DATASIZE_8BIT, spi_prescaler[spi_profile]);
+	spi_xfer(buf, len, len);
+}
+
+// 픽셀 스트림 (라인 버퍼)
+static void spi_send_pixels(const uint16_t *px, uint16_t n) {
+#if LCD_SPI_16BIT
+	spi_config(SPI_DATASIZE_16BIT, spi_prescaler[spi_profile]);
+	spi_xfer(px, n, (uint32_t) n * 2);
+#else
+	spi_send((const uint8_t*) px, (uint16_t) (n * 2));
+#endif
+}
+
+// CS 가 내려간 트랜잭션 안에서 명령 1바이트 (DC low → high 복귀)
+static void spi_command(uint8_t cmd) {
+	spi_wait();
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
+	spi_send(&cmd, 1);
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+}
+
+static void spi_window(uint8_t cmd, uint16_t a, uint16_t b) {
+	uint8_t buf[4] = { a >> 8, a, b >> 8, b };
+	spi_command(cmd);
+	spi_send(buf, 4);
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
+	if (hspi != HSPI_INSTANCE || spi_done == NULL)
+		return;
+	BaseType_t woken = pdFALSE;
+	xSemaphoreGiveFromISR(spi_done, &woken);
+	portYIELD_FROM_ISR(woken);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {
+	// 에러도 대기 중인 태스크를 깨움 (타임아웃까지 막히지 않도록)
+	HAL_SPI_TxCpltCallback(hspi);
+}
+
 /* Initialize SPI */
 void ILI9341_SPI_Init(void) {
 //MX_SPI5_Init();																							//SPI INIT
 //MX_GPIO_Init();																							//GPIO INIT
+	if (spi_done == NULL)
+		spi_done = xSemaphoreCreateBinaryStatic(&spi_done_buf);
+	ILI9341_SPI_SetProfile(LCD_SPI_SAFE); // 초기화 명령은 느린 클럭으로
 	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);	//CS OFF
 }
 
+void ILI9341_SPI_SetProfile(LCD_SPI_Profile_t profile) {
+	if (profile >= LCD_SPI_PROFILE_COUNT)
+		return;
+	spi_profile = profile;
+	// 현재 프레임 크기 유지, 클럭만 변경 (다음 전송부터 적용)
+	spi_config((HSPI_INSTANCE)->Init.DataSize, spi_prescaler[profile]);
+}
+
+LCD_SPI_Profile_t ILI9341_SPI_GetProfile(void) {
+	return spi_profile;
+}
+
+uint32_t ILI9341_SPI_Hz(void) {
+	// SCK = PCLK1 / 2^(BR + 1)
+	const uint32_t br = ((HSPI_INSTANCE)->Init.BaudRatePrescaler & SPI_CR1_BR)
+			>> SPI_CR1_BR_Pos;
+	return HAL_RCC_GetPCLK1Freq() >> (br + 1);
+}
+
 /*Send data (char) to LCD*/
 void ILI9341_SPI_Send(unsigned char SPI_Data) {
-	HAL_SPI_Transmit_DMA(HSPI_INSTANCE, &SPI_Data, 1);
+	spi_send(&SPI_Data, 1); // 1바이트는 항상 폴링 → 반환 시 전송 완료
 }
 
 /* Send command (char) to LCD */
 void ILI9341_Write_Command(uint8_t Command) {
+	spi_wait();
 	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
 	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
 	ILI9341_SPI_Send(Command);
@@ -108,6 +262,7 @@ void ILI9341_Write_Command(uint8_t Command) {
 
 /* Send Data (char) to LCD */
 void ILI9341_Write_Data(uint8_t Data) {
+	spi_wait();
 	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
 	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
 	ILI9341_SPI_Send(Data);
@@ -115,20 +270,57 @@ void ILI9341_Write_Data(uint8_t Data) {
 }
 
 /* Set Address - Location block - to draw into */
+// CS 한 번에 2A/2B/2C 를 모두 보냄 (바이트마다 CS 토글하던 11회 → 1회)
 void ILI9341_Set_Address(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2) {
-	ILI9341_Write_Command(0x2A);
-	ILI9341_Write_Data(X1 >> 8);
-	ILI9341_Write_Data(X1);
-	ILI9341_Write_Data(X2 >> 8);
-	ILI9341_Write_Data(X2);
+	g_lcd_spi_stats.windows++;
+	spi_wait();
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+	spi_window(0x2A, X1, X2);
+	spi_window(0x2B, Y1, Y2);
+	spi_command(0x2C);
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+}
+
+/* Pixel stream - Set_Address 이후 RGB565 데이터를 DMA 로 연속 전송 */
+void ILI9341_Begin_Pixels(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2) {
+	ILI9341_Set_Address(X1, Y1, X2, Y2);
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+}
+
+uint16_t* ILI9341_Line_Acquire(void) {
+	uint16_t *line = lcd_line[line_next];
+	line_next ^= 1;
+	// Acquire/Submit 을 번갈아 부르면 진행 중인 DMA 는 항상 다른 버퍼 → 대기 없음
+	if (spi_busy && spi_buf == line)
+		spi_wait();
+	return line;
+}
+
+void ILI9341_Line_Submit(const uint16_t *line, uint16_t pixels) {
+	g_lcd_spi_stats.pixels += pixels;
+	spi_send_pixels(line, pixels);
+}
 
-	ILI9341_Write_Command(0x2B);
-	ILI9341_Write_Data(Y1 >> 8);
-	ILI9341_Write_Data(Y1);
-	ILI9341_Write_Data(Y2 >> 8);
-	ILI9341_Write_Data(Y2);
+void ILI9341_Write_Buffer(const uint8_t *data, uint32_t len) {
+	// HAL DMA 길이는 16비트 → 나눠서 전송, 반환 전에 완료 (호출자 버퍼 보호)
+	g_lcd_spi_stats.pixels += len / 2;
+	while (len > 0) {
+		uint16_t chunk = (len > 0xFFF0u) ? 0xFFF0u : (uint16_t) len;
+		spi_send(data, chunk);
+		data += chunk;
+		len -= chunk;
+	}
+	spi_wait();
+}
+
+void ILI9341_End_Pixels(void) {
+	spi_wait();
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+}
 
-	ILI9341_Write_Command(0x2C);
+void ILI9341_Flush(void) {
+	spi_wait();
 }
 
 /*HARDWARE RESET*/
@@ -316,6 +508,8 @@ void ILI9341_Init(void) {
 
 //STARTING ROTATION
 	ILI9341_Set_Rotation(SCREEN_VERTICAL_1);
+
+	ILI9341_SPI_SetProfile(LCD_SPI_PROFILE_DEFAULT);
 }
 
 //INTERNAL FUNCTION OF LIBRARY, USAGE NOT RECOMENDED, USE Draw_Pixel INSTEAD
@@ -323,50 +517,36 @@ void ILI9341_Init(void) {
 void ILI9341_Draw_Colour(uint16_t Colour) {
 //SENDS COLOUR
 	unsigned char TempBuffer[2] = { Colour >> 8, Colour };
+	g_lcd_spi_stats.pixels++;
+	spi_wait();
 	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
 	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	HAL_SPI_Transmit_DMA(HSPI_INSTANCE, TempBuffer, 2);
+	spi_send(TempBuffer, 2); // 폴링 → CS 올리기 전에 전송 완료
 	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
 }
 
 //INTERNAL FUNCTION OF LIBRARY
 /*Sends block colour information to LCD*/
+// 라인 버퍼 하나를 색으로 한 번 채우고 같은 버퍼를 DMA 로 반복 전송
 void ILI9341_Draw_Colour_Burst(uint16_t Colour, uint32_t Size) {
-//SENDS COLOUR
-	uint32_t Buffer_Size = 0;
-	if ((Size * 2) < BURST_MAX_SIZE) {
-		Buffer_Size = Size;
-	} else {
-		Buffer_Size = BURST_MAX_SIZE;
-	}
+	uint16_t *line = ILI9341_Line_Acquire();
+	uint32_t fill = (Size < LCD_LINE_PIXELS) ? Size : LCD_LINE_PIXELS;
+	uint16_t value = ILI9341_LineColour(Colour);
+
+	spi_wait();
+	for (uint32_t j = 0; j < fill; j++)
+		line[j] = value;
 
 	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
 	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
 
-	unsigned char chifted = Colour >> 8;
-	;
-	unsigned char burst_buffer[Buffer_Size];
-	for (uint32_t j = 0; j < Buffer_Size; j += 2) {
-		burst_buffer[j] = chifted;
-		burst_buffer[j + 1] = Colour;
+	while (Size > 0) {
+		uint16_t n = (Size > fill) ? (uint16_t) fill : (uint16_t) Size;
+		ILI9341_Line_Submit(line, n);
+		Size -= n;
 	}
 
-	uint32_t Sending_Size = Size * 2;
-	uint32_t Sending_in_Block = Sending_Size / Buffer_Size;
-	uint32_t Remainder_from_block = Sending_Size % Buffer_Size;
-
-	if (Sending_in_Block != 0) {
-		for (uint32_t j = 0; j < (Sending_in_Block); j++) {
-			HAL_SPI_Transmit(HSPI_INSTANCE, (unsigned char*) burst_buffer,
-					Buffer_Size, HAL_MAX_DELAY);
-		}
-	}
-
-//REMAINDER!
-	HAL_SPI_Transmit(HSPI_INSTANCE, (unsigned char*) burst_buffer,
-			Remainder_from_block, HAL_MAX_DELAY);
-
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+	ILI9341_End_Pixels();
 }
 
 //FILL THE ENTIRE SCREEN WITH SELECTED COLOUR (either #define-d ones or custom 16bit)
@@ -386,45 +566,17 @@ void ILI9341_Draw_Pixel(uint16_t X, uint16_t Y, uint16_t Colour) {
 	if ((X >= LCD_WIDTH) || (Y >= LCD_HEIGHT))
 		return;	//OUT OF BOUNDS!
 
-//ADDRESS
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
+// ADDRESS + COLOUR, CS 한 번 (전부 폴링 크기라 스택 버퍼 사용 가능)
+	unsigned char Temp_Buffer[2] = { Colour >> 8, Colour };
+	g_lcd_spi_stats.windows++;
+	spi_wait();
 	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	ILI9341_SPI_Send(0x2A);
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-
-//XDATA
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	unsigned char Temp_Buffer[4] = { X >> 8, X, (X + 1) >> 8, (X + 1) };
-	HAL_SPI_Transmit(HSPI_INSTANCE, Temp_Buffer, 4, HAL_MAX_DELAY);
+	spi_window(0x2A, X, X + 1);
+	spi_window(0x2B, Y, Y + 1);
+	spi_command(0x2C);
+	spi_send(Temp_Buffer, 2);
+	g_lcd_spi_stats.pixels++;
 	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-
-//ADDRESS
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	ILI9341_SPI_Send(0x2B);
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-
-//YDATA
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	unsigned char Temp_Buffer1[4] = { Y >> 8, Y, (Y + 1) >> 8, (Y + 1) };
-	HAL_SPI_Transmit(HSPI_INSTANCE, Temp_Buffer1, 4, HAL_MAX_DELAY);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-
-//ADDRESS	
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	ILI9341_SPI_Send(0x2C);
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-
-//COLOUR	
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	unsigned char Temp_Buffer2[2] = { Colour >> 8, Colour };
-	HAL_SPI_Transmit(HSPI_INSTANCE, Temp_Buffer2, 2, HAL_MAX_DELAY);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-
 }
 
 //DRAW RECTANGLE OF SET SIZE AND HEIGTH AT X and Y POSITION WITH CUSTOM COLOUR
@@ -6,6 +6,24 @@
 #define M_PI 3.14159265358979323846
 #endif
 
+// 디노멀 방지
+// - 타겟(Cortex-M4F): FPSCR.FZ 를 켜서 하드웨어가 flush-to-zero (biquad_enable_flush_to_zero)
+// - 호스트(x86 등): 상태 변수를 소프트웨어로 0 처리
+#if defined(__ARM_FP)
+#define BIQUAD_FLUSH(v)  (v)
+#else
+#define BIQUAD_FLUSH(v)  ((((v) < 1e-20f) && ((v) > -1e-20f)) ? 0.0f : (v))
+#endif
+
+void biquad_enable_flush_to_zero(void)
+{
+#if defined(__ARM_FP)
+    // 현재 태스크의 FPSCR + 예외 진입 시 기본값(FPDSCR) 모두 FZ 설정
+    __set_FPSCR(__get_FPSCR() | FPU_FPDSCR_FZ_Msk);
+    FPU->FPDSCR |= FPU_FPDSCR_FZ_Msk;
+#endif
+}
+
 void biquad_reset(Biquad *q)
 {
     if (!q) return;
@@ -13,10 +31,10 @@ void biquad_reset(Biquad *q)
     q->y1 = q->y2 = 0.0f;
 }
 
-void biquad_set_lpf(Biquad *q, float Fs, float Fc, float Q)
+// RBJ low-pass 계수 계산 (a0 == 1 로 정규화)
+static void calc_lpf_coeffs(float Fs, float Fc, float Q,
+        float *b0, float *b1, float *b2, float *a1, float *a2)
 {
-    if (!q) return;
-
     // safety clamp
     if (Fs <= 0.0f) Fs = 48000.0f;
     if (Fc < 1.0f) Fc = 1.0f;
@@ -30,19 +48,26 @@ void biquad_set_lpf(Biquad *q, float Fs, float Fc, float Q)
     float alpha = sin0 / (2.0f * Q);
 
     // RBJ low-pass (unnormalized)
-    float b0 = (1.0f - cos0) * 0.5f;
-    float b1 =  1.0f - cos0;
-    float b2 = (1.0f - cos0) * 0.5f;
-    float a0 =  1.0f + alpha;
-    float a1 = -2.0f * cos0;
-    float a2 =  1.0f - alpha;
+    float nb0 = (1.0f - cos0) * 0.5f;
+    float nb1 =  1.0f - cos0;
+    float nb2 = (1.0f - cos0) * 0.5f;
+    float na0 =  1.0f + alpha;
+    float na1 = -2.0f * cos0;
+    float na2 =  1.0f - alpha;
 
     // normalize so that a0 == 1
-    q->b0 = b0 / a0;
-    q->b1 = b1 / a0;
-    q->b2 = b2 / a0;
-    q->a1 = a1 / a0;
-    q->a2 = a2 / a0;
+    float inv_a0 = 1.0f / na0;
+    *b0 = nb0 * inv_a0;
+    *b1 = nb1 * inv_a0;
+    *b2 = nb2 * inv_a0;
+    *a1 = na1 * inv_a0;
+    *a2 = na2 * inv_a0;
+}
+
+void biquad_set_lpf(Biquad *q, float Fs, float Fc, float Q)
+{
+    if (!q) return;
+    calc_lpf_coeffs(Fs, Fc, Q, &q->b0, &q->b1, &q->b2, &q->a1, &q->a2);
 }
 
 float biquad_process(Biquad *q, float x)
@@ -56,6 +81,8 @@ float biquad_process(Biquad *q, float x)
             - q->a1 * q->y1
             - q->a2 * q->y2;
 
+    y = BIQUAD_FLUSH(y);
+
     q->x2 = q->x1;
     q->x1 = x;
     q->y2 = q->y1;
@@ -63,3 +90,29 @@ float biquad_process(Biquad *q, float x)
 
     return y;
 }
+
+// ===== Transposed Direct Form II =====
+// 상태 2개(s1, s2)만 사용 → 로드/스토어가 DF-I(4개)의 절반
+
+void biquad_tdf2_reset(BiquadTDF2 *q)
+{
+    if (!q) return;
+    q->s1 = q->s2 = 0.0f;
+}
+
+void biquad_tdf2_set_lpf(BiquadTDF2 *q, float Fs, float Fc, float Q)
+{
+    if (!q) return;
+    calc_lpf_coeffs(Fs, Fc, Q, &q->b0, &q->b1, &q->b2, &q->a1, &q->a2);
+}
+
+float biquad_tdf2_process(BiquadTDF2 *q, float x)
+{
+    // y  = b0*x + s1
+    // s1 = b1*x - a1*y + s2
+    // s2 = b2*x - a2*y
+    float y = q->b0 * x + q->s1;
+    q->s1 = BIQUAD_FLUSH(q->b1 * x - q->a1 * y + q->s2);
+    q->s2 = BIQUAD_FLUSH(q->b2 * x - q->a2 * y);
+    return y;
+}
@@ -15,6 +15,12 @@
 
 #include "user_rtos.h"
 #include "ui.h"
+#include "noise.h"
+#include "fx_delay.h"
+#include "fx_reverb.h"
+#include "fx_chorus.h"
+#include "fx_drive.h"
+#include "mod.h"
 
 #define C1_GPIO_Port  GPIOB
 #define C1_Pin        GPIO_PIN_13
@@ -132,6 +138,81 @@ static void debounce_update(uint16_t raw, uint16_t *down_edges,
 
 /* ====== tasks ====== */
 
+// 키 0~6 → C D E F G A B 반음 오프셋
+static const uint8_t WHITE_KEY_SEMI[7] = { 0, 2, 4, 5, 7, 9, 11 };
+static uint8_t sharp_held = 0;
+static uint16_t shift_keys = 0;   // # 와 함께 눌려 두 번째 기능으로 처리 중인 키
+
+// # (키 15) 를 누른 채 7~14 번 키 → 두 번째 기능 (처리했으면 1)
+// 그 키의 UP 도 여기서 끝냄 (# 를 먼저 놓아도 첫 번째 기능으로 넘어가지 않게)
+static uint8_t shift_event(const InputEvent *e) {
+	const uint16_t bit = (uint16_t) (1u << e->key);
+
+	if (e->type == EV_KEY_UP) {
+		if (!(shift_keys & bit))
+			return 0;
+		shift_keys &= (uint16_t) ~bit;
+		if (e->key == 7 || e->key == 11)
+			Synth_SetPitchBend(0);
+		return 1;
+	}
+	if (!sharp_held || e->key < 7 || e->key > 14)
+		return 0;
+	shift_keys |= bit;
+
+	switch (e->key) {
+	case 7:
+		// 누르고 있는 동안 벤드 최대 (+2 반음)
+		Synth_SetPitchBend(8191);
+		break;
+	case 8:
+		// 딜레이 켜기/끄기
+		g_delay.enabled = !g_delay.enabled;
+		break;
+	case 9:
+		// 리버브 켜기/끄기 (프리셋은 컴파일 타임, REVERB_PRESET)
+		g_reverb.enabled = !g_reverb.enabled;
+		break;
+	case 10:
+		// 모듈레이션 순환: 끔 → 코러스 → 플랜저 (모드 기본값 적용)
+		if (!g_chorus.enabled) {
+			FX_Chorus_SetMode(CHORUS_MODE_CHORUS);
+			g_chorus.enabled = 1;
+		} else if (g_chorus.mode == CHORUS_MODE_CHORUS) {
+			FX_Chorus_SetMode(CHORUS_MODE_FLANGER);
+		} else {
+			g_chorus.enabled = 0;
+		}
+		break;
+	case 11:
+		Synth_SetPitchBend(-8192);
+		break;
+	case 12:
+		// 드라이브 순환: 끔 → 1x → 2x → 4x 오버샘플링
+		if (!g_drive.enabled) {
+			g_drive.oversample = 1;
+			g_drive.enabled = 1;
+		} else if (g_drive.oversample < 4) {
+			g_drive.oversample = (uint8_t) (g_drive.oversample * 2);
+		} else {
+			g_drive.enabled = 0;
+		}
+		break;
+	case 13:
+		// 모듈레이션 프리셋 순환: 끔 → 비브라토 → 컷오프 스윕 → ENV2 컷오프 → 웨이브테이블 스캔
+		Mod_SetPreset((Mod_Preset_t) ((g_mod_preset + 1) % MOD_PRESET_COUNT));
+		break;
+	case 14:
+		// 팬 스프레드 순환: 끔 → 보이스 순서 → 노트 높이 → 랜덤 (다음 NoteOn 부터)
+		Synth_SetPanSpread((PanSpread_t) ((g_pan_spread + 1) % PAN_SPREAD_COUNT),
+				g_pan_spread_amt);
+		break;
+	default:
+		break;
+	}
+	return 1;
+}
+
 static void print_event(const InputEvent *e) {
 	// 사람이 보기 좋게 1~16로 표시하려면 key+1
 
@@ -141,7 +222,9 @@ static void print_event(const InputEvent *e) {
 		xSemaphoreTake(printfMutex, portMAX_DELAY);
 
 	KEY = e->key;
-	if (e->type == EV_KEY_DOWN &&e->key == 7) {
+	if (shift_event(e)) {
+		// # + 기능 키 (shift_event)
+	} else if (e->type == EV_KEY_DOWN &&e->key == 7) {
 		UI_OnChangeOctave(1);
 	} else if (e->key == 8) {
 		current_lut = sine_lut;
@@ -151,11 +234,31 @@ static void print_event(const InputEvent *e) {
 		current_lut = saw_lut;
 	}else if (e->type == EV_KEY_DOWN &&e->key == 11) {
 		UI_OnChangeOctave(-1);
+	} else if (e->type == EV_KEY_DOWN && e->key == 12) {
+		// 글라이드 모드 순환: OFF → LEGATO → ALWAYS
+		Synth_SetGlide((GlideMode_t) ((g_glide_mode + 1) % GLIDE_MODE_COUNT),
+				g_glide_ms);
+	} else if (e->type == EV_KEY_DOWN && e->key == 13) {
+		// 보이스 모드 순환: 폴리 → 유니즌(슈퍼쏘) → FM → 웨이브테이블
+		// (웨이브테이블로 들어가면 LFO2 → 스캔 위치 라우팅이 기본으로 켜짐)
+		Synth_SetVoiceMode((VoiceMode_t) ((g_voice_mode + 1) % VOICE_MODE_COUNT));
+	} else if (e->type == EV_KEY_DOWN && e->key == 14) {
+		// 노이즈 순환: 끔 → 화이트 → 핑크
+		g_noise_type = (NoiseType_t) ((g_noise_type + 1) % NOISE_TYPE_COUNT);
+	}
+
+	if (e->key == 15) {
+		// 누르고 있는 동안 반음 올림 (#)
+		sharp_held = (e->type == EV_KEY_DOWN);
 	}
 
 	if (e->type == EV_KEY_DOWN && e->key < 7) {
-		target_freq = freq_list[e->key];
-		NoteOn();
+		// 흰 건반 → MIDI 노트 (옥타브 4 = C4 = 60)
+		uint8_t note = (uint8_t) ((g_ui_oct + 1) * 12 + WHITE_KEY_SEMI[e->key]
+				+ sharp_held);
+		g_ui_note = note;
+		UI_Notify(UI_EVT_MODEL); // 음계 표시 갱신 (LCD_Task 가 값 비교)
+		NoteOn(note);
 	} else if (e->type == EV_KEY_UP && e->key < 7) {
 		NoteOff();
 	}
@@ -197,6 +300,16 @@ static void KeyScanTask(void *arg) {
 	}
 }
 
+void Printf_Lock(void) {
+	if (printfMutex)
+		xSemaphoreTake(printfMutex, portMAX_DELAY);
+}
+
+void Printf_Unlock(void) {
+	if (printfMutex)
+		xSemaphoreGive(printfMutex);
+}
+
 /* ====== init: StartDefaultTask에서 한 번만 호출 ====== */
 void KeypadTasks_Init(void) {
 	if (printfMutex == NULL) {
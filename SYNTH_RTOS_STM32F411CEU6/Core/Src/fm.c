@@ -0,0 +1,184 @@
+/*
+ * fm.c
+ *
+ *  FM(위상 변조) 오퍼레이터 엔진
+ *  - 변조기 출력은 위상 오프셋(uint32, 2^32 = 한 주기)으로 저장 → 캐리어 위상에 정수 덧셈
+ *  - 오퍼레이터 처리 순서는 op4 → op1 (변조기가 항상 먼저 계산됨)
+ */
+
+#include "fm.h"
+#include "user_rtos.h"
+
+// 알고리즘 테이블
+typedef struct {
+	uint8_t mod_mask[FM_NUM_OPS]; // 오퍼레이터별 변조 입력 (비트 = 변조기 번호)
+	uint8_t carrier_mask;         // 출력으로 나가는 오퍼레이터
+	uint8_t active_mask;          // 계산이 필요한 오퍼레이터 (캐리어 + 쓰이는 변조기)
+	uint8_t num_carriers;
+} FM_Algo_t;
+
+static const FM_Algo_t fm_algos[FM_ALG_COUNT] = {
+	[FM_ALG_STACK] = { { 0x2, 0x4, 0x8, 0x0 }, 0x1, 0xF, 1 },
+	[FM_ALG_Y] = { { 0x2, 0xC, 0x0, 0x0 }, 0x1, 0xF, 1 },
+	[FM_ALG_TWO_STACKS] = { { 0x2, 0x0, 0x8, 0x0 }, 0x5, 0xF, 2 },
+	[FM_ALG_ONE_TO_THREE] = { { 0x8, 0x8, 0x8, 0x0 }, 0x7, 0xF, 3 },
+	[FM_ALG_TWO_OP] = { { 0x2, 0x0, 0x0, 0x0 }, 0x1, 0x3, 1 },
+	[FM_ALG_ADDITIVE] = { { 0x0, 0x0, 0x0, 0x0 }, 0xF, 0xF, 4 },
+};
+
+// 레벨 1.0 변조기의 LUT 피크(LUT_AMPLITUDE) → 위상 편이 FM_INDEX_MAX rad
+#define FM_PM_SCALE  (FM_INDEX_MAX / 6.2831853f * 4294967296.0f / (float) LUT_AMPLITUDE)
+
+#define MS_TO_TICKS(ms)  ((uint16_t) (((uint32_t) (ms) * SAMPLE_RATE) / (1000u * MOD_SUBBLOCK)))
+
+FM_Patch_t g_fm_patch;
+
+void FM_Init(void) {
+	// 기본 패치: 일렉트릭 피아노 계열 (몸통 스택 + 고배음 틴 스택)
+	g_fm_patch.algorithm = FM_ALG_TWO_STACKS;
+	g_fm_patch.feedback = 0;
+	FM_SetOperator(0, 1.0f, 1.0f, 2, 1500, 0.3f, 300);   // 캐리어 (몸통)
+	FM_SetOperator(1, 1.0f, 0.45f, 2, 900, 0.1f, 300);   // 변조기
+	FM_SetOperator(2, 1.0f, 0.6f, 2, 400, 0.0f, 200);    // 캐리어 (틴)
+	FM_SetOperator(3, 14.0f, 0.25f, 1, 120, 0.0f, 100);  // 변조기 (고배음)
+}
+
+void FM_SetAlgorithm(FM_Algorithm_t alg) {
+	if (alg < FM_ALG_COUNT)
+		g_fm_patch.algorithm = alg;
+}
+
+void FM_SetFeedback(uint8_t fb) {
+	if (fb > FM_FEEDBACK_MAX)
+		fb = FM_FEEDBACK_MAX;
+	g_fm_patch.feedback = fb;
+}
+
+void FM_SetOperator(uint8_t idx, float ratio, float level, uint16_t attack_ms,
+		uint16_t decay_ms, float sustain, uint16_t release_ms) {
+	if (idx >= FM_NUM_OPS || !(ratio > 0.0f) || ratio > FM_RATIO_MAX)
+		return;
+	if (level < 0.0f)
+		level = 0.0f;
+	if (level > 1.0f)
+		level = 1.0f;
+
+	FM_Operator_t *op = &g_fm_patch.op[idx];
+	op->ratio_q16 = (uint32_t) (ratio * 65536.0f + 0.5f);
+	op->level = level;
+	op->env.attack_ticks = MS_TO_TICKS(attack_ms);
+	op->env.decay_ticks = MS_TO_TICKS(decay_ms);
+	op->env.sustain_level = sustain;
+	op->env.release_ticks = MS_TO_TICKS(release_ms);
+	op->env.state = ENV_IDLE;
+	op->env.level = 0.0f;
+	op->env.step = 0.0f;
+}
+
+void FM_NoteOn(FM_Voice_t *fv) {
+	for (int i = 0; i < FM_NUM_OPS; i++) {
+		// 위상을 0으로 맞춰야 어택 음색이 매번 같음
+		fv->phase[i] = 0;
+		fv->env[i] = g_fm_patch.op[i].env;
+		Mod_EnvGate(&fv->env[i], 1);
+		fv->gain[i] = 0.0f;
+		fv->gain_end[i] = 0.0f;
+	}
+	fv->fb_prev[0] = 0;
+	fv->fb_prev[1] = 0;
+}
+
+void FM_NoteOff(FM_Voice_t *fv) {
+	for (int i = 0; i < FM_NUM_OPS; i++)
+		Mod_EnvGate(&fv->env[i], 0);
+}
+
+void FM_Tick(FM_Voice_t *fv) {
+	for (int i = 0; i < FM_NUM_OPS; i++) {
+		Mod_EnvTick(&fv->env[i]);
+		fv->gain[i] = fv->gain_end[i];
+		fv->gain_end[i] = fv->env[i].level * g_fm_patch.op[i].level;
+	}
+}
+
+uint32_t FM_Render(FM_Voice_t *fv, uint32_t word, int32_t step, float *out,
+		int n) {
+	static uint32_t op_pm[FM_NUM_OPS][MOD_SUBBLOCK]; // 변조기 출력 (위상 오프셋)
+	static uint32_t pm_in[MOD_SUBBLOCK];              // 오퍼레이터별 변조 입력 합
+
+	const FM_Algo_t *alg = &fm_algos[g_fm_patch.algorithm];
+	const float car_norm = 1.0f / (float) alg->num_carriers;
+	uint32_t ops = 0;
+
+	for (int i = FM_NUM_OPS - 1; i >= 0; i--) {
+		const uint8_t bit = (uint8_t) (1u << i);
+		if ((alg->active_mask & bit) == 0)
+			continue;
+		ops++;
+
+		// 변조 입력 합산 (uint32 덧셈 = 위상 wrap 그대로)
+		const uint8_t mm = alg->mod_mask[i];
+		for (int j = 0; j < n; j++)
+			pm_in[j] = 0;
+		for (int m = 0; m < FM_NUM_OPS; m++) {
+			if (mm & (1u << m)) {
+				for (int j = 0; j < n; j++)
+					pm_in[j] += op_pm[m][j];
+			}
+		}
+
+		// 오퍼레이터 주파수 = 보이스 tuning word x 비율 (램프도 같은 비율)
+		// 64비트 곱 후 하위 32비트 = mod 2^32 (비율이 커서 나이퀴스트를 넘어도 위상은 정상 wrap,
+		// float → uint32 변환은 범위를 넘으면 정의되지 않음 — Cortex-M 은 0xFFFFFFFF 로 포화)
+		const uint32_t ratio_q16 = g_fm_patch.op[i].ratio_q16;
+		uint32_t ph = fv->phase[i];
+		uint32_t w = (uint32_t) (((uint64_t) word * ratio_q16) >> 16);
+		uint32_t w_step = (uint32_t) (((int64_t) step * (int64_t) ratio_q16) >> 16);
+
+		float g = fv->gain[i];
+		const float g_step = (fv->gain_end[i] - g) / (float) n;
+
+		// 캐리어/변조기 여부에 따라 출력 배율 (0이면 해당 경로 기여 없음)
+		const float car = (alg->carrier_mask & bit) ? car_norm : 0.0f;
+		const float pm_k = FM_PM_SCALE;
+
+		// 피드백은 최상위(op4)만, DX 방식: 직전 출력 2개 평균 >> 시프트
+		const int fb_on = (i == FM_NUM_OPS - 1) && (g_fm_patch.feedback > 0);
+		const int fb_shift = FM_FEEDBACK_MAX - g_fm_patch.feedback;
+		int32_t p1 = fv->fb_prev[0];
+		int32_t p2 = fv->fb_prev[1];
+		uint32_t *pm_out = op_pm[i];
+
+		if (fb_on) {
+			for (int j = 0; j < n; j++) {
+				uint32_t mod = pm_in[j]
+						+ (uint32_t) (((p1 >> 1) + (p2 >> 1)) >> fb_shift);
+				float s = (float) sine_lut[(ph + mod) >> LUT_SHIFT] * g;
+				ph += w;
+				w += w_step;
+				g += g_step;
+
+				int32_t pm = (int32_t) (s * pm_k);
+				p2 = p1;
+				p1 = pm;
+				pm_out[j] = (uint32_t) pm;
+				out[j] += s * car;
+			}
+			fv->fb_prev[0] = p1;
+			fv->fb_prev[1] = p2;
+		} else {
+			for (int j = 0; j < n; j++) {
+				float s = (float) sine_lut[(ph + pm_in[j]) >> LUT_SHIFT] * g;
+				ph += w;
+				w += w_step;
+				g += g_step;
+
+				pm_out[j] = (uint32_t) (int32_t) (s * pm_k);
+				out[j] += s * car;
+			}
+		}
+		fv->phase[i] = ph;
+	}
+
+	return ops * (uint32_t) n;
+}
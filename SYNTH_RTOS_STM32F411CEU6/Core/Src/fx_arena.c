@@ -0,0 +1,41 @@
+/*
+ * fx_arena.c
+ *
+ *  이펙트 메모리 아레나
+ */
+
+#include "fx_arena.h"
+#include "fx_drive.h"
+#include "fx_chorus.h"
+#include "fx_delay.h"
+#include "fx_reverb.h"
+
+// 모든 이펙트 스테이지 요구량 합 (스테이지 추가 시 여기에 더할 것)
+#define FX_ARENA_BYTES  (FX_DRIVE_RAM_BYTES + FX_CHORUS_RAM_BYTES + FX_DELAY_RAM_BYTES \
+		+ FX_REVERB_RAM_BYTES)
+
+static uint8_t fx_arena[FX_ARENA_BYTES] __attribute__((aligned(4)));
+static size_t fx_arena_used = 0;
+
+void FX_Arena_Reset(void) {
+	fx_arena_used = 0;
+}
+
+void* FX_Arena_Alloc(size_t bytes) {
+	size_t size = (bytes + 3u) & ~(size_t) 3u;
+
+	if (size > FX_ARENA_BYTES - fx_arena_used)
+		return NULL;
+
+	void *p = &fx_arena[fx_arena_used];
+	fx_arena_used += size;
+	return p;
+}
+
+size_t FX_Arena_Used(void) {
+	return fx_arena_used;
+}
+
+size_t FX_Arena_Size(void) {
+	return FX_ARENA_BYTES;
+}
@@ -0,0 +1,70 @@
+/*
+ * fx_chain.c
+ *
+ *  포스트 믹스 이펙트 체인
+ */
+
+#include "fx_chain.h"
+#include "fx_arena.h"
+#include "fx_drive.h"
+#include "fx_chorus.h"
+#include "fx_delay.h"
+#include "fx_reverb.h"
+#include "fx_comp.h"
+#include "user_rtos.h"
+#include <stdio.h>
+
+static FX_Stage_t fx_stages[FX_STAGE_COUNT] = {
+	[FX_STAGE_DRIVE] = { "drive", FX_Drive_Init, FX_Drive_Process, "os-smp", &g_drive.enabled },
+	[FX_STAGE_FILTER] = { "filter", NULL, Synth_Filter_Process, "frame", NULL },
+	[FX_STAGE_CHORUS] = { "chorus", FX_Chorus_Init, FX_Chorus_Process, "frame", &g_chorus.enabled },
+	[FX_STAGE_DELAY] = { "delay", FX_Delay_Init, FX_Delay_Process, "frame", &g_delay.enabled },
+	[FX_STAGE_REVERB] = { "reverb", FX_Reverb_Init, FX_Reverb_Process, "frame", &g_reverb.enabled },
+	[FX_STAGE_COMP] = { "comp", FX_Comp_Init, FX_Comp_Process, "frame", &g_comp.enabled },
+};
+
+// 처리 순서 (드라이브는 필터 앞, 공간계는 뒤, 컴프는 마지막)
+static const uint8_t fx_order[FX_STAGE_COUNT] = { FX_STAGE_DRIVE,
+		FX_STAGE_FILTER, FX_STAGE_CHORUS, FX_STAGE_DELAY, FX_STAGE_REVERB,
+		FX_STAGE_COMP };
+
+void FX_Chain_Init(void) {
+	FX_Arena_Reset();
+
+	// 스테이지 init 의 [FX] 리포트까지 한 번에 (KeyScan 출력과 섞이지 않게)
+	Printf_Lock();
+	for (int i = 0; i < FX_STAGE_COUNT; i++) {
+		FX_Stage_t *s = &fx_stages[i];
+		s->ready = (s->init == NULL) || (s->init() == 0);
+		if (!s->ready)
+			printf("[FX] %s: init failed (arena)\r\n", s->name);
+	}
+
+	printf("[FX] arena: %lu / %lu B\r\n", (unsigned long) FX_Arena_Used(),
+			(unsigned long) FX_Arena_Size());
+	Printf_Unlock();
+}
+
+void FX_Chain_PerfInit(uint32_t frames) {
+	for (int i = 0; i < FX_STAGE_COUNT; i++) {
+		Perf_BlockInit(&fx_stages[i].perf, fx_stages[i].name, frames);
+		Perf_BlockSetUnit(&fx_stages[i].perf, fx_stages[i].unit);
+	}
+}
+
+void FX_Chain_Process(float *l, float *r, int n) {
+	for (uint8_t k = 0; k < FX_STAGE_COUNT; k++) {
+		FX_Stage_t *s = &fx_stages[fx_order[k]];
+		if (!s->ready || (s->enabled != NULL && !*s->enabled))
+			continue;
+
+		uint32_t t0 = Perf_Now();
+		uint32_t units = s->process(l, r, n);
+		Perf_BlockAccum(&s->perf, Perf_Now() - t0, units);
+	}
+}
+
+void FX_Chain_Commit(void) {
+	for (int i = 0; i < FX_STAGE_COUNT; i++)
+		Perf_BlockCommit(&fx_stages[i].perf);
+}
@@ -0,0 +1,122 @@
+/*
+ * fx_chorus.c
+ *
+ *  코러스 / 플랜저
+ */
+
+#include "fx_chorus.h"
+#include "delay_line.h"
+#include "fx_arena.h"
+#include "user_rtos.h"
+#include <stdio.h>
+
+static DelayLine_t dl_l;
+static DelayLine_t dl_r;
+
+static uint32_t lfo_phase = 0;
+static uint32_t delay_l_q16 = 0;   // 직전 서브블록 끝 딜레이 (램프 시작점)
+static uint32_t delay_r_q16 = 0;
+
+volatile Chorus_Params_t g_chorus = { .enabled = 0, .mode = CHORUS_MODE_CHORUS,
+		.rate_hz = 0.8f, .base_ms = 12.0f, .depth_ms = 4.0f, .feedback = 0.0f,
+		.mix = 0.5f };
+
+int FX_Chorus_Init(void) {
+	int16_t *buf = FX_Arena_Alloc(FX_CHORUS_RAM_BYTES);
+
+	if (buf == NULL)
+		return -1;
+	DL_Init(&dl_l, buf, FX_CHORUS_MAX_FRAMES);
+	DL_Init(&dl_r, buf + FX_CHORUS_MAX_FRAMES, FX_CHORUS_MAX_FRAMES);
+	lfo_phase = 0;
+	delay_l_q16 = 0;
+	delay_r_q16 = 0;
+
+	printf("[FX] chorus: %lu B SRAM\r\n", (unsigned long) FX_CHORUS_RAM_BYTES);
+	return 0;
+}
+
+void FX_Chorus_SetMode(Chorus_Mode_t mode) {
+	g_chorus.mode = mode;
+	if (mode == CHORUS_MODE_FLANGER) {
+		g_chorus.rate_hz = 0.25f;
+		g_chorus.base_ms = 2.5f;
+		g_chorus.depth_ms = 2.0f;
+		g_chorus.feedback = 0.6f;
+		g_chorus.mix = 0.5f;
+	} else {
+		g_chorus.rate_hz = 0.8f;
+		g_chorus.base_ms = 12.0f;
+		g_chorus.depth_ms = 4.0f;
+		g_chorus.feedback = 0.0f;
+		g_chorus.mix = 0.5f;
+	}
+}
+
+// LFO(-1.0 ~ 1.0) → 딜레이 Q16 샘플 (보간용 1샘플 여유를 두고 클램프)
+static uint32_t delay_q16(float lfo, float base_smp, float depth_smp) {
+	float d = base_smp + lfo * depth_smp;
+	const float d_max = (float) (FX_CHORUS_MAX_FRAMES - 2);
+
+	if (d < 1.0f)
+		d = 1.0f;
+	if (d > d_max)
+		d = d_max;
+	return (uint32_t) (d * 65536.0f);
+}
+
+uint32_t FX_Chorus_Process(float *l, float *r, int n) {
+	if (!g_chorus.enabled || n <= 0)
+		return 0;
+
+	const float ms_to_smp = (float) SAMPLE_RATE / 1000.0f;
+	const float base = g_chorus.base_ms * ms_to_smp;
+	const float depth = g_chorus.depth_ms * ms_to_smp;
+	const float mix = g_chorus.mix;
+
+	float fb = g_chorus.feedback;
+	if (fb > 0.9f)
+		fb = 0.9f;
+	if (fb < -0.9f)
+		fb = -0.9f;
+
+	// LFO는 서브블록 끝 값만 LUT에서 읽음 (R은 90도 늦게)
+	uint32_t rate_word = (uint32_t) (g_chorus.rate_hz
+			* (4294967296.0f / (float) SAMPLE_RATE));
+	lfo_phase += rate_word * (uint32_t) n;
+
+	const float inv_amp = 1.0f / (float) LUT_AMPLITUDE;
+	float lfo_l = (float) sine_lut[lfo_phase >> LUT_SHIFT] * inv_amp;
+	float lfo_r = (float) sine_lut[(lfo_phase + 0x40000000u) >> LUT_SHIFT]
+			* inv_amp;
+
+	uint32_t end_l = delay_q16(lfo_l, base, depth);
+	uint32_t end_r = delay_q16(lfo_r, base, depth);
+	if (delay_l_q16 == 0) {
+		delay_l_q16 = end_l;
+		delay_r_q16 = end_r;
+	}
+
+	// 시작 → 끝 딜레이 램프 (Q16, 정수 덧셈)
+	uint32_t d_l = delay_l_q16;
+	uint32_t d_r = delay_r_q16;
+	const int32_t step_l = ((int32_t) end_l - (int32_t) d_l) / n;
+	const int32_t step_r = ((int32_t) end_r - (int32_t) d_r) / n;
+
+	for (int j = 0; j < n; j++) {
+		float yl = DL_ReadFrac(&dl_l, d_l);
+		float yr = DL_ReadFrac(&dl_r, d_r);
+		d_l += (uint32_t) step_l;
+		d_r += (uint32_t) step_r;
+
+		DL_Write(&dl_l, DL_ToQ15(l[j] + fb * yl));
+		DL_Write(&dl_r, DL_ToQ15(r[j] + fb * yr));
+
+		l[j] += mix * yl;
+		r[j] += mix * yr;
+	}
+
+	delay_l_q16 = d_l;
+	delay_r_q16 = d_r;
+	return (uint32_t) n;
+}
@@ -0,0 +1,90 @@
+/*
+ * fx_comp.c
+ *
+ *  마스터 버스 컴프레서
+ *  - dB ↔ 선형 변환은 fast_log2f / fast_exp2f (블록당 몇 번이라 powf/log10f 불필요)
+ */
+
+#include "fx_comp.h"
+#include "dsp_math.h"
+#include "user_rtos.h"
+#include <math.h>
+
+#define DB_PER_LOG2   6.0205999f    // 20 * log10(2)
+#define LOG2_PER_DB   0.16609640f   // 1 / DB_PER_LOG2
+#define RMS_WINDOW_MS 20.0f         // 평균 제곱 스무딩 시간
+
+static float env_ms = 0.0f;     // 스무딩된 평균 제곱
+static float gr_db = 0.0f;      // 어택/릴리즈 적용된 게인 리덕션 (양수)
+static float gain = 1.0f;       // 직전 블록 끝 게인 (보간 시작점)
+
+volatile Comp_Params_t g_comp = { .enabled = 1, .threshold_db = -12.0f,
+		.ratio = 3.0f, .attack_ms = 10.0f, .release_ms = 150.0f,
+		.makeup_db = 0.0f, .ceiling_db = -0.5f };
+volatile float g_comp_gr_db = 0.0f;
+
+int FX_Comp_Init(void) {
+	env_ms = 0.0f;
+	gr_db = 0.0f;
+	gain = 1.0f;
+	g_comp_gr_db = 0.0f;
+	return 0;
+}
+
+// n 샘플 동안의 1극 스무딩 계수: 1 - e^(-n / (τ·Fs))
+static inline float block_coef(float tau_ms, int n) {
+	if (tau_ms < 0.1f)
+		return 1.0f;
+	float x = (float) n * 1000.0f / (tau_ms * (float) SAMPLE_RATE);
+	return 1.0f - fast_exp2f(-x * 1.4426950f);
+}
+
+uint32_t FX_Comp_Process(float *l, float *r, int n) {
+	if (!g_comp.enabled || n <= 0)
+		return 0;
+
+	// 1) 블록 검출: 스테레오 평균 제곱 + 피크
+	float sum = 0.0f;
+	float peak = 0.0f;
+	for (int j = 0; j < n; j++) {
+		float a = l[j], b = r[j];
+		sum += a * a + b * b;
+		float m = fabsf(a) > fabsf(b) ? fabsf(a) : fabsf(b);
+		if (m > peak)
+			peak = m;
+	}
+	float ms = sum * 0.5f / (float) n;
+	env_ms += (ms - env_ms) * block_coef(RMS_WINDOW_MS, n);
+
+	// 2) 게인 계산 (하드 니, dB 영역)
+	float level_db = (env_ms > 1e-12f) ? 0.5f * DB_PER_LOG2 * fast_log2f(env_ms) : -120.0f;
+	float ratio = g_comp.ratio < 1.0f ? 1.0f : g_comp.ratio;
+	float over = level_db - g_comp.threshold_db;
+	float target = (over > 0.0f) ? over * (1.0f - 1.0f / ratio) : 0.0f;
+
+	// 3) 어택 (리덕션 증가) / 릴리즈 (감소)
+	float tau = (target > gr_db) ? g_comp.attack_ms : g_comp.release_ms;
+	gr_db += (target - gr_db) * block_coef(tau, n);
+	g_comp_gr_db = gr_db;
+
+	float g_end = fast_exp2f((g_comp.makeup_db - gr_db) * LOG2_PER_DB);
+
+	// 4) 피크 천장: 이번 블록 피크가 상한을 넘지 않게 (RMS 검출이 놓치는 트랜지언트)
+	if (g_comp.ceiling_db < 0.0f && peak > 0.0f) {
+		float lim = fast_exp2f(g_comp.ceiling_db * LOG2_PER_DB);
+		if (peak * g_end > lim)
+			g_end = lim / peak;
+	}
+
+	// 5) 블록 안 게인 선형 보간
+	float g = gain;
+	const float g_step = (g_end - g) / (float) n;
+	for (int j = 0; j < n; j++) {
+		g += g_step;
+		l[j] *= g;
+		r[j] *= g;
+	}
+	gain = g_end;
+
+	return (uint32_t) n;
+}
@@ -0,0 +1,174 @@
+/*
+ * fx_delay.c
+ *
+ *  스테레오 피드백 딜레이
+ *  - 서브블록 단위 처리, wrap은 DL_Span()으로 구간을 나눠서 처리 (루프 안에 % / 분기 없음)
+ *  - 시간 변경: 읽기 인덱스가 점프하면 클릭 → 이전 탭(old)과 새 탭을 FX_DELAY_XFADE 동안 섞음
+ *    크로스페이드 중에 또 바뀌면 끝난 뒤 다음 블록에서 반영
+ */
+
+#include "fx_delay.h"
+#include "delay_line.h"
+#include "fx_arena.h"
+#include "user_rtos.h"
+#include <stdio.h>
+
+static DelayLine_t dl_l;
+static DelayLine_t dl_r;
+
+// 피드백 경로 damping LPF 상태
+static float damp_l = 0.0f;
+static float damp_r = 0.0f;
+
+// 현재 딜레이 길이 / 크로스페이드 상태 (이전 길이, 남은 프레임, 새 탭 비율)
+static uint32_t d_cur = 0;
+static uint32_t d_old = 0;
+static uint32_t xf_left = 0;
+static float xf_g = 1.0f;
+
+// 기본값은 기본 버퍼(약 92 ms)에 들어가는 슬랩백
+volatile Delay_Params_t g_delay = { .enabled = 0, .ping_pong = 0, .sync =
+		DELAY_SYNC_OFF, .bpm = 120, .time_ms = 80, .feedback = 0.35f,
+		.damping = 0.3f, .mix = 0.25f };
+
+// 4분음표 대비 길이 (천분율)
+static const uint16_t sync_permille[DELAY_SYNC_COUNT] = { 0, 250, 333, 500,
+		750, 1000 };
+
+int FX_Delay_Init(void) {
+	int16_t *buf = FX_Arena_Alloc(FX_DELAY_RAM_BYTES);
+
+	if (buf == NULL)
+		return -1;
+	DL_Init(&dl_l, buf, FX_DELAY_MAX_FRAMES);
+	DL_Init(&dl_r, buf + FX_DELAY_MAX_FRAMES, FX_DELAY_MAX_FRAMES);
+	damp_l = 0.0f;
+	damp_r = 0.0f;
+	d_cur = FX_Delay_Frames();
+	xf_left = 0;
+	xf_g = 1.0f;
+
+	printf("[FX] delay: %lu B SRAM, max %lu ms\r\n",
+			(unsigned long) FX_DELAY_RAM_BYTES,
+			(unsigned long) (FX_DELAY_MAX_FRAMES * 1000u / SAMPLE_RATE));
+	return 0;
+}
+
+uint32_t FX_Delay_Frames(void) {
+	uint32_t frames;
+	Delay_Sync_t sync = g_delay.sync;
+
+	if (sync == DELAY_SYNC_OFF || sync >= DELAY_SYNC_COUNT) {
+		frames = ((uint32_t) g_delay.time_ms * SAMPLE_RATE) / 1000u;
+	} else {
+		uint32_t bpm = g_delay.bpm;
+		if (bpm < 20)
+			bpm = 20;
+		// 4분음표 = 60/bpm 초
+		frames = (uint32_t) (((uint64_t) 60u * SAMPLE_RATE * sync_permille[sync])
+				/ ((uint64_t) bpm * 1000u));
+	}
+
+	if (frames < 1)
+		frames = 1;
+	if (frames > FX_DELAY_MAX_FRAMES)
+		frames = FX_DELAY_MAX_FRAMES;
+	return frames;
+}
+
+uint32_t FX_Delay_Process(float *l, float *r, int n) {
+	if (!g_delay.enabled)
+		return 0;
+
+	// 새 길이는 크로스페이드가 없을 때만 시작 (old = 지금 들리는 탭)
+	const uint32_t d = FX_Delay_Frames();
+	if (xf_left == 0 && d != d_cur) {
+		d_old = d_cur;
+		d_cur = d;
+		xf_left = FX_DELAY_XFADE;
+		xf_g = 0.0f;
+	}
+
+	const float mix = g_delay.mix;
+	const float inv = 1.0f / 32768.0f;
+	const float xf_step = 1.0f / (float) FX_DELAY_XFADE;
+
+	float fb = g_delay.feedback;
+	if (fb < 0.0f)
+		fb = 0.0f;
+	if (fb > 0.95f)
+		fb = 0.95f;
+
+	// damping 0 → 계수 1(필터 없음), 1 → 0.05(매우 어두움)
+	const float a = 1.0f - 0.95f * g_delay.damping;
+
+	// 쓰기 = 입력 x 행렬 + 피드백 (일반/핑퐁을 계수로 통일해서 루프 안 분기 제거)
+	float in_ll = 1.0f, in_lr = 0.0f, in_rr = 1.0f;
+	float fb_same = fb, fb_cross = 0.0f;
+	if (g_delay.ping_pong) {
+		in_ll = 0.5f;
+		in_lr = 0.5f;
+		in_rr = 0.0f;
+		fb_same = 0.0f;
+		fb_cross = fb;
+	}
+
+	float fl = damp_l, fr = damp_r;
+	uint32_t wr = dl_l.pos;
+	uint32_t rd = DL_Index(&dl_l, d_cur);
+	// 크로스페이드가 없으면 old 탭 = 새 탭 (g = 1 이라 old 는 결과에 안 들어감)
+	uint32_t ro = (xf_left > 0) ? DL_Index(&dl_l, d_old) : rd;
+	uint32_t left = (uint32_t) n;
+
+	while (left > 0) {
+		uint32_t span = DL_Span(&dl_l, rd, wr, left);
+		span = DL_Span(&dl_l, ro, wr, span);
+		// 크로스페이드 끝에서 구간을 끊어 g 가 1 을 넘지 않게
+		if (xf_left > 0 && span > xf_left)
+			span = xf_left;
+		const float g_step = (xf_left > 0) ? xf_step : 0.0f;
+
+		const int16_t *src_l = &dl_l.buf[rd];
+		const int16_t *src_r = &dl_r.buf[rd];
+		const int16_t *old_l = &dl_l.buf[ro];
+		const int16_t *old_r = &dl_r.buf[ro];
+		int16_t *dst_l = &dl_l.buf[wr];
+		int16_t *dst_r = &dl_r.buf[wr];
+		float g = xf_g;
+
+		for (uint32_t k = 0; k < span; k++) {
+			float ol = (float) old_l[k];
+			float orr = (float) old_r[k];
+			float yl = (ol + g * ((float) src_l[k] - ol)) * inv;
+			float yr = (orr + g * ((float) src_r[k] - orr)) * inv;
+			g += g_step;
+			fl += a * (yl - fl);
+			fr += a * (yr - fr);
+
+			float xl = l[k], xr = r[k];
+			dst_l[k] = DL_ToQ15(in_ll * xl + in_lr * xr + fb_same * fl + fb_cross * fr);
+			dst_r[k] = DL_ToQ15(in_rr * xr + fb_same * fr + fb_cross * fl);
+
+			l[k] = xl + mix * yl;
+			r[k] = xr + mix * yr;
+		}
+
+		if (xf_left > 0) {
+			xf_left -= span;
+			xf_g = (xf_left == 0) ? 1.0f : g;
+		}
+
+		l += span;
+		r += span;
+		left -= span;
+		rd = DL_Wrap(&dl_l, rd + span);
+		wr = DL_Wrap(&dl_l, wr + span);
+		ro = (xf_left > 0) ? DL_Wrap(&dl_l, ro + span) : rd;
+	}
+
+	dl_l.pos = wr;
+	dl_r.pos = wr;
+	damp_l = fl;
+	damp_r = fr;
+	return (uint32_t) n;
+}
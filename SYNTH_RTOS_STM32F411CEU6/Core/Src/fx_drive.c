@@ -0,0 +1,234 @@
+/*
+ * fx_drive.c
+ *
+ *  오버샘플링 드라이브
+ *  - 하프밴드 계수는 Blackman 창 sinc, 초기화 때 1회 계산 (중앙 제외 짝수 오프셋 탭은 0)
+ *  - 인터폴레이터 계수는 x2 (0 삽입으로 줄어든 레벨 보상)
+ */
+
+#include "fx_drive.h"
+#include "fx_arena.h"
+#include "dsp_math.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(ARM_MATH_CM4)
+#include "arm_math.h"
+#endif
+
+// 2x 단 하나 (업 + 다운), 채널별
+typedef struct {
+#if defined(ARM_MATH_CM4)
+	arm_fir_interpolate_instance_f32 up;
+	arm_fir_decimate_instance_f32 down;
+#else
+	const float *up_h;
+	const float *down_h;
+	uint16_t up_taps;
+	uint16_t down_taps;
+	float *up_x;         // 최근 입력 (up_taps / 2개, [0] = 최신)
+	float *down_x;       // 최근 입력 (down_taps개, [0] = 최신)
+#endif
+	float *mem;          // 상태 메모리 (리셋용)
+	uint16_t mem_len;
+} HB_Stage_t;
+
+static float hb1_up_h[DRIVE_HB1_UP_TAPS];
+static float hb1_down_h[DRIVE_HB1_TAPS];
+static float hb2_up_h[DRIVE_HB2_UP_TAPS];
+static float hb2_down_h[DRIVE_HB2_TAPS];
+
+static HB_Stage_t hb1[2];   // 1x ↔ 2x (L, R)
+static HB_Stage_t hb2[2];   // 2x ↔ 4x (L, R)
+static uint8_t last_os = 1;
+
+volatile Drive_Params_t g_drive = { .enabled = 0, .oversample = 2,
+		.drive_db = 12.0f, .level = 0.5f };
+
+// 하프밴드 저역통과 (차단 fs/4), 합 = 1 로 정규화
+static void design_halfband(float *h, int taps) {
+	const int mid = (taps - 1) / 2;
+	float sum = 0.0f;
+
+	for (int k = 0; k < taps; k++) {
+		int m = k - mid;
+		float s;
+		if (m == 0)
+			s = 0.5f;
+		else if ((m & 1) == 0)
+			s = 0.0f;
+		else
+			s = sinf(3.14159265f * 0.5f * (float) m) / (3.14159265f * (float) m);
+
+		float w = 0.42f - 0.5f * cosf(6.2831853f * (float) k / (float) (taps - 1))
+				+ 0.08f * cosf(12.566371f * (float) k / (float) (taps - 1));
+		h[k] = s * w;
+		sum += h[k];
+	}
+	for (int k = 0; k < taps; k++)
+		h[k] /= sum;
+}
+
+static int hb_init(HB_Stage_t *s, const float *up_h, uint16_t up_taps,
+		const float *down_h, uint16_t down_taps, uint32_t block) {
+	uint16_t up_len = (uint16_t) (up_taps / 2 + block - 1);
+	uint16_t down_len = (uint16_t) (down_taps + 2 * block - 1);
+	float *mem = FX_Arena_Alloc((up_len + down_len) * sizeof(float));
+
+	if (mem == NULL)
+		return -1;
+	s->mem = mem;
+	s->mem_len = (uint16_t) (up_len + down_len);
+	memset(mem, 0, s->mem_len * sizeof(float));
+
+#if defined(ARM_MATH_CM4)
+	// 탭 수가 L 의 배수가 아니거나 블록이 M 의 배수가 아니면 ARM_MATH_LENGTH_ERROR
+	if (arm_fir_interpolate_init_f32(&s->up, 2, up_taps, up_h, mem, block)
+			!= ARM_MATH_SUCCESS)
+		return -1;
+	if (arm_fir_decimate_init_f32(&s->down, down_taps, 2, down_h, mem + up_len,
+			2 * block) != ARM_MATH_SUCCESS)
+		return -1;
+#else
+	s->up_h = up_h;
+	s->up_taps = up_taps;
+	s->up_x = mem;
+	s->down_h = down_h;
+	s->down_taps = down_taps;
+	s->down_x = mem + up_len;
+#endif
+	return 0;
+}
+
+static inline void hb_reset(HB_Stage_t *s) {
+	memset(s->mem, 0, s->mem_len * sizeof(float));
+}
+
+// n 샘플 → 2n 샘플
+static inline void hb_up(HB_Stage_t *s, const float *in, float *out, int n) {
+#if defined(ARM_MATH_CM4)
+	arm_fir_interpolate_f32(&s->up, in, out, (uint32_t) n);
+#else
+	const int p = s->up_taps / 2;
+	float *x = s->up_x;
+
+	for (int i = 0; i < n; i++) {
+		memmove(&x[1], &x[0], (size_t) (p - 1) * sizeof(float));
+		x[0] = in[i];
+
+		// 짝수/홀수 위상 = 0 삽입 후 FIR 의 두 출력
+		float y0 = 0.0f, y1 = 0.0f;
+		for (int j = 0; j < p; j++) {
+			y0 += s->up_h[2 * j] * x[j];
+			y1 += s->up_h[2 * j + 1] * x[j];
+		}
+		out[2 * i] = y0;
+		out[2 * i + 1] = y1;
+	}
+#endif
+}
+
+// 2n 샘플 → n 샘플 (남는 출력은 계산하지 않음)
+static inline void hb_down(HB_Stage_t *s, const float *in, float *out, int n) {
+#if defined(ARM_MATH_CM4)
+	arm_fir_decimate_f32(&s->down, in, out, (uint32_t) (2 * n));
+#else
+	const int t = s->down_taps;
+	float *x = s->down_x;
+
+	for (int i = 0; i < n; i++) {
+		memmove(&x[2], &x[0], (size_t) (t - 2) * sizeof(float));
+		x[1] = in[2 * i];
+		x[0] = in[2 * i + 1];
+
+		float y = 0.0f;
+		for (int k = 0; k < t; k++)
+			y += s->down_h[k] * x[k];
+		out[i] = y;
+	}
+#endif
+}
+
+// 3차 소프트 클리퍼 (|x| >= 1 에서 ±1, 그 아래는 3차 배음만)
+static inline float soft_clip(float x) {
+	if (x >= 1.0f)
+		return 1.0f;
+	if (x <= -1.0f)
+		return -1.0f;
+	return x * (1.5f - 0.5f * x * x);
+}
+
+static void shape(float *x, int n, float gain, float level) {
+	for (int j = 0; j < n; j++)
+		x[j] = soft_clip(x[j] * gain) * level;
+}
+
+int FX_Drive_Init(void) {
+	design_halfband(hb1_down_h, DRIVE_HB1_TAPS);
+	design_halfband(hb2_down_h, DRIVE_HB2_TAPS);
+	for (int k = 0; k < DRIVE_HB1_UP_TAPS; k++)
+		hb1_up_h[k] = (k < DRIVE_HB1_TAPS) ? 2.0f * hb1_down_h[k] : 0.0f;
+	for (int k = 0; k < DRIVE_HB2_UP_TAPS; k++)
+		hb2_up_h[k] = (k < DRIVE_HB2_TAPS) ? 2.0f * hb2_down_h[k] : 0.0f;
+
+	for (int c = 0; c < 2; c++) {
+		if (hb_init(&hb1[c], hb1_up_h, DRIVE_HB1_UP_TAPS, hb1_down_h,
+				DRIVE_HB1_TAPS, MOD_SUBBLOCK) != 0)
+			return -1;
+		if (hb_init(&hb2[c], hb2_up_h, DRIVE_HB2_UP_TAPS, hb2_down_h,
+				DRIVE_HB2_TAPS, 2 * MOD_SUBBLOCK) != 0)
+			return -1;
+	}
+	last_os = 1;
+
+	printf("[FX] drive: %lu B SRAM, taps %d/%d\r\n",
+			(unsigned long) FX_DRIVE_RAM_BYTES, DRIVE_HB1_TAPS, DRIVE_HB2_TAPS);
+	return 0;
+}
+
+uint32_t FX_Drive_Process(float *l, float *r, int n) {
+	static float os2[2 * MOD_SUBBLOCK];
+	static float os4[4 * MOD_SUBBLOCK];
+
+	if (!g_drive.enabled || n <= 0 || n > MOD_SUBBLOCK)
+		return 0;
+
+	uint8_t os = g_drive.oversample;
+	if (os != 2 && os != 4)
+		os = 1;
+
+	// 배율이 바뀌면 새로 쓰이는 단의 이전 상태를 비움 (오래된 샘플이 튀는 것 방지)
+	if (os != last_os) {
+		for (int c = 0; c < 2; c++) {
+			hb_reset(&hb1[c]);
+			hb_reset(&hb2[c]);
+		}
+		last_os = os;
+	}
+
+	// dB → 배율: 10^(dB/20) = 2^(dB * log2(10) / 20)
+	const float gain = fast_exp2f(g_drive.drive_db * 0.16609640f);
+	const float level = g_drive.level;
+	float *ch[2] = { l, r };
+
+	for (int c = 0; c < 2; c++) {
+		float *x = ch[c];
+
+		if (os == 1) {
+			shape(x, n, gain, level);
+		} else if (os == 2) {
+			hb_up(&hb1[c], x, os2, n);
+			shape(os2, 2 * n, gain, level);
+			hb_down(&hb1[c], os2, x, n);
+		} else {
+			hb_up(&hb1[c], x, os2, n);
+			hb_up(&hb2[c], os2, os4, 2 * n);
+			shape(os4, 4 * n, gain, level);
+			hb_down(&hb2[c], os4, os2, 2 * n);
+			hb_down(&hb1[c], os2, x, n);
+		}
+	}
+
+	return (uint32_t) n * os;
+}
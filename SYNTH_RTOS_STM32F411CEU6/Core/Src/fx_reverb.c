@@ -0,0 +1,212 @@
+/*
+ * fx_reverb.c
+ *
+ *  FDN 리버브
+ *  - 모든 라인이 "전체 길이" 딜레이라서 읽기 = 쓰기 위치 (라인당 포인터 1개)
+ *  - wrap은 라인들 중 가장 먼저 끝나는 곳까지 구간을 나눠서 처리 (루프 안에 % / 분기 없음)
+ */
+
+#include "fx_reverb.h"
+#include "delay_line.h"
+#include "fx_arena.h"
+#include "user_rtos.h"
+#include "mod.h"
+#include <math.h>
+#include <stdio.h>
+
+// 프리셋별 라인/디퓨저 길이 (모두 소수, 합계는 fx_reverb.h 의 REVERB_xxx_TOTAL 과 일치)
+#if REVERB_PRESET == REVERB_PRESET_LOW
+#define REVERB_LINES       4
+#define REVERB_DIFFUSERS   0
+static const uint16_t line_len[REVERB_LINES] = { 1009, 1201, 1409, 1601 };
+#elif REVERB_PRESET == REVERB_PRESET_MED
+#define REVERB_LINES       4
+#define REVERB_DIFFUSERS   2
+static const uint16_t line_len[REVERB_LINES] = { 1427, 1787, 2143, 2503 };
+static const uint16_t diff_len[REVERB_DIFFUSERS] = { 227, 347 };
+#elif REVERB_PRESET == REVERB_PRESET_HIGH
+#define REVERB_LINES       8
+#define REVERB_DIFFUSERS   3
+static const uint16_t line_len[REVERB_LINES] = { 1117, 1277, 1433, 1601, 1759,
+		1931, 2111, 2287 };
+static const uint16_t diff_len[REVERB_DIFFUSERS] = { 113, 227, 347 };
+#endif
+
+#define DIFFUSER_GAIN   0.6f
+
+static DelayLine_t lines[REVERB_LINES];
+static float line_gain[REVERB_LINES];   // RT60 맞춤 피드백 게인
+static float line_lp[REVERB_LINES];     // damping LPF 상태
+#if REVERB_DIFFUSERS > 0
+static DelayLine_t diffusers[REVERB_DIFFUSERS];
+#endif
+
+volatile Reverb_Params_t g_reverb = { .enabled = 0, .decay_s = 1.8f,
+		.damping = 0.4f, .mix = 0.2f };
+
+// 파라미터가 바뀌었을 때만 라인 게인 재계산 (powf는 여기서만)
+static void update_gains(void) {
+	static float last_decay = -1.0f;
+	float decay = g_reverb.decay_s;
+
+	if (decay == last_decay)
+		return;
+	last_decay = decay;
+	if (decay < 0.1f)
+		decay = 0.1f;
+
+	// 한 바퀴(len 샘플) 동안 -60dB * len / (RT60 * Fs)
+	for (int i = 0; i < REVERB_LINES; i++) {
+		line_gain[i] = powf(10.0f,
+				-3.0f * (float) line_len[i] / (decay * (float) SAMPLE_RATE));
+	}
+}
+
+int FX_Reverb_Init(void) {
+	int16_t *p = FX_Arena_Alloc(FX_REVERB_RAM_BYTES);
+
+	if (p == NULL)
+		return -1;
+
+	for (int i = 0; i < REVERB_LINES; i++) {
+		DL_Init(&lines[i], p, line_len[i]);
+		p += line_len[i];
+		line_lp[i] = 0.0f;
+	}
+#if REVERB_DIFFUSERS > 0
+	for (int i = 0; i < REVERB_DIFFUSERS; i++) {
+		DL_Init(&diffusers[i], p, diff_len[i]);
+		p += diff_len[i];
+	}
+#endif
+	update_gains();
+
+	printf("[FX] reverb: preset %d, %d lines, %lu B SRAM\r\n", REVERB_PRESET,
+			REVERB_LINES, (unsigned long) FX_REVERB_RAM_BYTES);
+	return 0;
+}
+
+// 하다마드 행렬 (버터플라이, 정규화 1/sqrt(N))
+static inline void hadamard(float *v) {
+	for (int h = 1; h < REVERB_LINES; h <<= 1) {
+		for (int i = 0; i < REVERB_LINES; i += 2 * h) {
+			for (int k = i; k < i + h; k++) {
+				float a = v[k];
+				float b = v[k + h];
+				v[k] = a + b;
+				v[k + h] = a - b;
+			}
+		}
+	}
+}
+
+#if REVERB_DIFFUSERS > 0
+// 입력 디퓨저: 슈뢰더 올패스 직렬 (블록 단위, 구간 분할 wrap)
+static void diffuse(float *x, int n) {
+	const float inv = 1.0f / 32768.0f;
+
+	for (int d = 0; d < REVERB_DIFFUSERS; d++) {
+		DelayLine_t *dl = &diffusers[d];
+		uint32_t pos = dl->pos;
+		uint32_t left = (uint32_t) n;
+		float *px = x;
+
+		while (left > 0) {
+			uint32_t span = DL_Span(dl, pos, pos, left);
+			int16_t *b = &dl->buf[pos];
+
+			for (uint32_t k = 0; k < span; k++) {
+				float z = (float) b[k] * inv;
+				float w = px[k] + DIFFUSER_GAIN * z;
+				px[k] = z - DIFFUSER_GAIN * w;
+				b[k] = DL_ToQ15(w);
+			}
+			px += span;
+			left -= span;
+			pos = DL_Wrap(dl, pos + span);
+		}
+		dl->pos = pos;
+	}
+}
+#endif
+
+uint32_t FX_Reverb_Process(float *l, float *r, int n) {
+	static float in[MOD_SUBBLOCK];
+
+	if (!g_reverb.enabled || n > MOD_SUBBLOCK)
+		return 0;
+
+	update_gains();
+
+	const float inv = 1.0f / 32768.0f;
+	const float a = 1.0f - 0.9f * g_reverb.damping;
+	const float norm = 1.0f / sqrtf((float) REVERB_LINES);
+	const float out_k = g_reverb.mix * (2.0f / (float) REVERB_LINES);
+
+	// 모노 입력 (+ 디퓨전)
+	for (int j = 0; j < n; j++)
+		in[j] = 0.5f * (l[j] + r[j]);
+#if REVERB_DIFFUSERS > 0
+	diffuse(in, n);
+#endif
+
+	float lp[REVERB_LINES];
+	float g[REVERB_LINES];
+	uint32_t pos[REVERB_LINES];
+	for (int i = 0; i < REVERB_LINES; i++) {
+		lp[i] = line_lp[i];
+		g[i] = line_gain[i] * norm;
+		pos[i] = lines[i].pos;
+	}
+
+	int j = 0;
+	while (j < n) {
+		// 모든 라인이 wrap 없이 갈 수 있는 길이
+		uint32_t span = (uint32_t) (n - j);
+		for (int i = 0; i < REVERB_LINES; i++) {
+			uint32_t room = lines[i].size - pos[i];
+			if (room < span)
+				span = room;
+		}
+
+		int16_t *p[REVERB_LINES];
+		for (int i = 0; i < REVERB_LINES; i++)
+			p[i] = &lines[i].buf[pos[i]];
+
+		for (uint32_t k = 0; k < span; k++) {
+			float v[REVERB_LINES];
+			float x = in[j + k];
+
+			// 라인 출력 → damping
+			for (int i = 0; i < REVERB_LINES; i++) {
+				float y = (float) p[i][k] * inv;
+				lp[i] += a * (y - lp[i]);
+				v[i] = lp[i];
+			}
+
+			// 스테레오 출력: 짝수 라인 → L, 홀수 라인 → R
+			float wl = 0.0f, wr = 0.0f;
+			for (int i = 0; i < REVERB_LINES; i += 2) {
+				wl += v[i];
+				wr += v[i + 1];
+			}
+			l[j + k] += wl * out_k;
+			r[j + k] += wr * out_k;
+
+			// 피드백: 하다마드 혼합 x 감쇠 게인 + 입력
+			hadamard(v);
+			for (int i = 0; i < REVERB_LINES; i++)
+				p[i][k] = DL_ToQ15(x + g[i] * v[i]);
+		}
+
+		j += (int) span;
+		for (int i = 0; i < REVERB_LINES; i++)
+			pos[i] = DL_Wrap(&lines[i], pos[i] + span);
+	}
+
+	for (int i = 0; i < REVERB_LINES; i++) {
+		line_lp[i] = lp[i];
+		lines[i].pos = pos[i];
+	}
+	return (uint32_t) n;
+}
@@ -0,0 +1,67 @@
+/*
+ * lcd_damage.c
+ *
+ *  손상 영역 목록
+ *  - 영역 a, b 를 따로 보내면 주소 창 2번 + (a + b) 픽셀,
+ *    합치면 주소 창 1번 + union 픽셀 → union 이 늘리는 픽셀이 주소 창 1번보다 싸면 병합
+ */
+
+#include "lcd_damage.h"
+
+static LCD_Rect_t dmg[DAMAGE_MAX_RECTS];
+static int dmg_count;
+
+// 합쳤을 때 늘어나는 전송 바이트 (음수 = 합치는 쪽이 이득)
+static int32_t merge_cost(const LCD_Rect_t *a, const LCD_Rect_t *b) {
+	LCD_Rect_t u = LCD_RectUnion(a, b);
+	return 2 * (LCD_RectArea(&u) - LCD_RectArea(a) - LCD_RectArea(b))
+			- LCD_WINDOW_BYTES;
+}
+
+void Damage_Add(int x0, int y0, int x1, int y1) {
+	LCD_Rect_t r = { (int16_t) ((x0 < x1) ? x0 : x1), (int16_t) ((y0 < y1) ? y0 : y1),
+			(int16_t) ((x0 < x1) ? x1 : x0), (int16_t) ((y0 < y1) ? y1 : y0) };
+
+	// 병합하면 이득인 사각형을 흡수 (커진 r 이 다른 사각형과 또 합쳐질 수 있어 반복)
+	for (int i = 0; i < dmg_count;) {
+		if (merge_cost(&r, &dmg[i]) <= 0) {
+			r = LCD_RectUnion(&r, &dmg[i]);
+			dmg[i] = dmg[--dmg_count];
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+
+	if (dmg_count < DAMAGE_MAX_RECTS) {
+		dmg[dmg_count++] = r;
+		return;
+	}
+
+	// 목록이 가득 참 → 비용이 가장 작은 사각형과 병합
+	int best = 0;
+	int32_t best_cost = merge_cost(&r, &dmg[0]);
+	for (int i = 1; i < dmg_count; i++) {
+		int32_t c = merge_cost(&r, &dmg[i]);
+		if (c < best_cost) {
+			best_cost = c;
+			best = i;
+		}
+	}
+	dmg[best] = LCD_RectUnion(&r, &dmg[best]);
+}
+
+void Damage_AddFrame(int x0, int y0, int x1, int y1) {
+	Damage_Add(x0, y0, x1, y0);
+	Damage_Add(x0, y1, x1, y1);
+	Damage_Add(x0, y0, x0, y1);
+	Damage_Add(x1, y0, x1, y1);
+}
+
+int Damage_Take(LCD_Rect_t *out) {
+	int n = dmg_count;
+	for (int i = 0; i < n; i++)
+		out[i] = dmg[i];
+	dmg_count = 0;
+	return n;
+}
@@ -0,0 +1,274 @@
+/*
+ * lcd_draw.c
+ *
+ *  LCD 그리기 레이어
+ *  - ILI9341_Draw_Pixel 1점 = CS 1회 + 13바이트 (2A/2B/2C 명령 + 좌표 + 색)
+ *  - span n 픽셀 = 주소 창 11바이트 + 2n 바이트 (버스트는 라인 버퍼 DMA)
+ *  - 타일은 RAM 에서 합성 후 한 번에 전송 (화면 지우기 없음 → 깜빡임 없음)
+ *  - 글자 1개 (size 2) = 기존 배경 사각형 + 켜진 점마다 사각형 (~25 x 19바이트)
+ *    → 문자열 전체가 주소 창 1번 + 픽셀 스트림
+ */
+
+#include "lcd_draw.h"
+#include "ILI9341_STM32_Driver.h"
+#include "5x5_font.h"
+#include <string.h>
+
+static inline int imin(int a, int b) {
+	return (a < b) ? a : b;
+}
+
+static inline int imax(int a, int b) {
+	return (a > b) ? a : b;
+}
+
+static LCD_Rect_t clip;
+static uint8_t clip_on;
+
+int LCD_RectIntersect(const LCD_Rect_t *a, const LCD_Rect_t *b, LCD_Rect_t *out) {
+	LCD_Rect_t r = { (int16_t) imax(a->x0, b->x0), (int16_t) imax(a->y0, b->y0),
+			(int16_t) imin(a->x1, b->x1), (int16_t) imin(a->y1, b->y1) };
+	if (r.x0 > r.x1 || r.y0 > r.y1)
+		return 0;
+	if (out)
+		*out = r;
+	return 1;
+}
+
+void LCD_SetClip(const LCD_Rect_t *r) {
+	clip_on = (r != NULL);
+	if (r)
+		clip = *r;
+}
+
+// 현재 유효 영역 = 화면 ∩ 클립
+static LCD_Rect_t clip_area(void) {
+	LCD_Rect_t scr = { 0, 0, (int16_t) (LCD_WIDTH - 1), (int16_t) (LCD_HEIGHT - 1) };
+	LCD_Rect_t r = scr;
+	if (clip_on && !LCD_RectIntersect(&scr, &clip, &r))
+		r.x1 = -1; // 빈 영역
+	return r;
+}
+
+void LCD_FillRect(int x0, int y0, int x1, int y1, uint16_t color) {
+	const LCD_Rect_t c = clip_area();
+	int xa = imax(imin(x0, x1), c.x0);
+	int xb = imin(imax(x0, x1), c.x1);
+	int ya = imax(imin(y0, y1), c.y0);
+	int yb = imin(imax(y0, y1), c.y1);
+	if (xa > xb || ya > yb)
+		return;
+
+	ILI9341_Set_Address((uint16_t) xa, (uint16_t) ya, (uint16_t) xb,
+			(uint16_t) yb);
+	ILI9341_Draw_Colour_Burst(color, (uint32_t) (xb - xa + 1) * (yb - ya + 1));
+}
+
+// span 콜백 (양 끝점 포함, 순서 무관), 화면/타일 래스터라이저가 공유
+typedef void (*span_fn_t)(void *ctx, int x0, int y0, int x1, int y1,
+		uint16_t c);
+
+static void raster_line(int x0, int y0, int x1, int y1, uint16_t c,
+		span_fn_t span, void *ctx) {
+	const int dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+	const int dy = (y1 > y0) ? (y0 - y1) : (y1 - y0); // 음수
+	const int sx = (x0 < x1) ? 1 : -1;
+	const int sy = (y0 < y1) ? 1 : -1;
+	const int x_major = (dx >= -dy);
+
+	int err = dx + dy;
+	int x = x0, y = y0;
+	int rx = x0, ry = y0; // 현재 span 시작점
+
+	while (x != x1 || y != y1) {
+		int nx = x, ny = y;
+		int e2 = 2 * err;
+		if (e2 >= dy) {
+			err += dy;
+			nx += sx;
+		}
+		if (e2 <= dx) {
+			err += dx;
+			ny += sy;
+		}
+
+		// 부축 좌표가 바뀌면 지금까지의 span 전송 (완만: 같은 y, 가파름: 같은 x)
+		if (x_major ? (ny != y) : (nx != x)) {
+			span(ctx, rx, ry, x, y, c);
+			rx = nx;
+			ry = ny;
+		}
+		x = nx;
+		y = ny;
+	}
+	span(ctx, rx, ry, x, y, c);
+}
+
+static void screen_span(void *ctx, int x0, int y0, int x1, int y1,
+		uint16_t c) {
+	(void) ctx;
+	LCD_FillRect(x0, y0, x1, y1, c);
+}
+
+void LCD_DrawFrame(int x0, int y0, int x1, int y1, uint16_t color) {
+	LCD_FillRect(x0, y0, x1, y0, color);
+	LCD_FillRect(x0, y1, x1, y1, color);
+	LCD_FillRect(x0, y0, x0, y1, color);
+	LCD_FillRect(x1, y0, x1, y1, color);
+}
+
+void LCD_DrawLine(int x0, int y0, int x1, int y1, uint16_t color) {
+	raster_line(x0, y0, x1, y1, color, screen_span, NULL);
+}
+
+// ===== 텍스트 =====
+
+// 글리프 행 마스크: 비트 i = 글자 칸 왼쪽에서 i 번째 픽셀 (size 배 확장 완료)
+typedef struct {
+	char c;
+	uint8_t size;   // 0 = 빈 슬롯
+	uint64_t rows[CHAR_HEIGHT];
+} LCD_Glyph_t;
+
+static LCD_Glyph_t glyph_cache[LCD_GLYPH_CACHE];
+
+static const LCD_Glyph_t* glyph_get(char c, int size) {
+	LCD_Glyph_t *g = &glyph_cache[((uint8_t) c * 7u + (unsigned) size)
+			& (LCD_GLYPH_CACHE - 1)];
+	if (g->c == c && g->size == size)
+		return g;
+
+	// 폰트는 32 ~ 127, 범위 밖은 공백
+	const uint8_t idx = ((uint8_t) c < ' ' || (uint8_t) c > 127) ?
+			0 : (uint8_t) (c - ' ');
+	const uint64_t run = (1ull << size) - 1;
+
+	for (int i = 0; i < CHAR_HEIGHT; i++) {
+		uint64_t m = 0;
+		for (int j = 0; j < CHAR_WIDTH; j++)
+			if (font[idx][j] & (1u << i))
+				m |= run << (j * size);
+		g->rows[i] = m;
+	}
+	g->c = c;
+	g->size = (uint8_t) size;
+	return g;
+}
+
+void LCD_DrawText(const char *s, int x, int y, uint16_t fg, uint16_t bg,
+		int size) {
+	if (size < 1 || size > LCD_TEXT_MAX_SIZE)
+		return;
+
+	const int gw = CHAR_WIDTH * size;
+	const LCD_Rect_t tr = { (int16_t) x, (int16_t) y,
+			(int16_t) (x + (int) strlen(s) * gw - 1),
+			(int16_t) (y + CHAR_HEIGHT * size - 1) };
+	const LCD_Rect_t c = clip_area();
+	LCD_Rect_t r;
+	if (tr.x1 < tr.x0 || !LCD_RectIntersect(&tr, &c, &r))
+		return;
+
+	const uint16_t fg_s = ILI9341_LineColour(fg);
+	const uint16_t bg_s = ILI9341_LineColour(bg);
+	const int n = r.x1 - r.x0 + 1;
+	const int k0 = (r.x0 - x) / gw;     // 클립 안 첫 글자
+	const int col0 = (r.x0 - x) % gw;   // 그 글자 안 시작 열
+
+	ILI9341_Begin_Pixels((uint16_t) r.x0, (uint16_t) r.y0, (uint16_t) r.x1,
+			(uint16_t) r.y1);
+	for (int py = r.y0; py <= r.y1; py++) {
+		const int row = (py - y) / size;
+		uint16_t *line = ILI9341_Line_Acquire();
+		int i = 0;
+		for (int k = k0, col = col0; i < n; k++, col = 0) {
+			const uint64_t m = glyph_get(s[k], size)->rows[row];
+			for (; col < gw && i < n; col++)
+				line[i++] = ((m >> col) & 1u) ? fg_s : bg_s;
+		}
+		ILI9341_Line_Submit(line, (uint16_t) n);
+	}
+	ILI9341_End_Pixels();
+}
+
+// ===== 2bpp 타일 =====
+
+void LCD_TileInit(LCD_Tile_t *t, uint8_t *bits, uint16_t w, uint16_t h) {
+	t->bits = bits;
+	t->w = w;
+	t->h = h;
+	t->stride = (uint16_t) LCD_TILE_STRIDE(w);
+	for (int i = 0; i < 4; i++)
+		t->pal[i] = BLACK;
+}
+
+void LCD_TileClear(LCD_Tile_t *t, uint8_t idx) {
+	memset(t->bits, (idx & 3) * 0x55, (size_t) t->stride * t->h);
+}
+
+static inline void tile_put(LCD_Tile_t *t, int x, int y, uint8_t idx) {
+	uint8_t *p = &t->bits[y * t->stride + (x >> 2)];
+	const int sh = (x & 3) * 2;
+	*p = (uint8_t) ((*p & ~(3u << sh)) | ((idx & 3u) << sh));
+}
+
+void LCD_TilePixel(LCD_Tile_t *t, int x, int y, uint8_t idx) {
+	if (x < 0 || y < 0 || x >= t->w || y >= t->h)
+		return;
+	tile_put(t, x, y, idx);
+}
+
+static void tile_span(void *ctx, int x0, int y0, int x1, int y1, uint16_t c) {
+	LCD_Tile_t *t = (LCD_Tile_t*) ctx;
+	int xa = imax(imin(x0, x1), 0);
+	int xb = imin(imax(x0, x1), t->w - 1);
+	int ya = imax(imin(y0, y1), 0);
+	int yb = imin(imax(y0, y1), t->h - 1);
+	for (int y = ya; y <= yb; y++)
+		for (int x = xa; x <= xb; x++)
+			tile_put(t, x, y, (uint8_t) c);
+}
+
+void LCD_TileLine(LCD_Tile_t *t, int x0, int y0, int x1, int y1, uint8_t idx) {
+	raster_line(x0, y0, x1, y1, idx, tile_span, t);
+}
+
+void LCD_TileFrame(LCD_Tile_t *t, uint8_t idx) {
+	const int r = t->w - 1, b = t->h - 1;
+	tile_span(t, 0, 0, r, 0, idx);
+	tile_span(t, 0, b, r, b, idx);
+	tile_span(t, 0, 0, 0, b, idx);
+	tile_span(t, r, 0, r, b, idx);
+}
+
+void LCD_TileBlit(const LCD_Tile_t *t, int x, int y) {
+	if (x < 0 || y < 0 || x + t->w > (int) LCD_WIDTH
+			|| y + t->h > (int) LCD_HEIGHT || t->w > LCD_LINE_PIXELS)
+		return;
+
+	const LCD_Rect_t c = clip_area();
+	const LCD_Rect_t tr = { (int16_t) x, (int16_t) y, (int16_t) (x + t->w - 1),
+			(int16_t) (y + t->h - 1) };
+	LCD_Rect_t r;
+	if (!LCD_RectIntersect(&tr, &c, &r))
+		return;
+
+	uint16_t pal[4];
+	for (int i = 0; i < 4; i++)
+		pal[i] = ILI9341_LineColour(t->pal[i]);
+
+	// 주소 창 1번, 행마다 라인 버퍼로 펼쳐서 DMA (다음 행은 전송 중에 펼침)
+	const int c0 = r.x0 - x, n = r.x1 - r.x0 + 1;
+	ILI9341_Begin_Pixels((uint16_t) r.x0, (uint16_t) r.y0, (uint16_t) r.x1,
+			(uint16_t) r.y1);
+	for (int row = r.y0 - y; row <= r.y1 - y; row++) {
+		const uint8_t *src = &t->bits[row * t->stride];
+		uint16_t *line = ILI9341_Line_Acquire();
+		for (int i = 0; i < n; i++) {
+			const int col = c0 + i;
+			line[i] = pal[(src[col >> 2] >> ((col & 3) * 2)) & 3];
+		}
+		ILI9341_Line_Submit(line, (uint16_t) n);
+	}
+	ILI9341_End_Pixels();
+}
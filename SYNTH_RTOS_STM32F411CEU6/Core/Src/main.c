@@ -24,6 +24,8 @@
 /* USER CODE BEGIN Includes */
 #include "user_rtos.h"
 #include "ui.h"
+#include "perf.h"
+#include "spectrum.h"
 #include <stdio.h>
 /* USER CODE END Includes */
 
@@ -57,7 +59,7 @@ TIM_HandleTypeDef htim5;
 osThreadId_t defaultTaskHandle;
 const osThreadAttr_t defaultTask_attributes = {
   .name = "defaultTask",
-  .stack_size = 128 * 4,
+  .stack_size = 256 * 4,
   .priority = (osPriority_t) osPriorityNormal,
 };
 /* USER CODE BEGIN PV */
@@ -154,6 +156,7 @@ int main(void)
 	/* add threads, ... */
 	UI_Init();
 	InitTasks();
+	Spectrum_Init();
 	KeypadTasks_Init();
 	RotaryTasks_Init();
   /* USER CODE END RTOS_THREADS */
@@ -523,6 +526,7 @@ void StartDefaultTask(void *argument)
 	for (;;) {
 //		printf("uart ok!\n");
 		Test();
+		Perf_Report(); // 약 1초마다 오디오 블록 사이클 리포트 (SWV ITM)
 	}
   /* USER CODE END 5 */
 }
@@ -0,0 +1,227 @@
+/*
+ * mod.c
+ *
+ *  모듈레이션 매트릭스 (컨트롤 레이트)
+ *  - LFO는 기존 파형 LUT(sine_lut / saw_lut)를 그대로 읽음
+ *  - 모든 계산은 서브블록당 1회라서 float 사용
+ */
+
+#include "mod.h"
+#include "user_rtos.h"
+#include "dsp_math.h"
+
+Mod_LFO_t g_mod_lfo[MOD_NUM_LFOS];
+Mod_Slot_t g_mod_slots[MOD_NUM_SLOTS];
+
+// 보조 엔벨로프 기본값 (NoteOn 시 보이스에 복사)
+Mod_Env_t g_mod_env2_preset = { .attack_ticks = 14,   // 약 10ms
+		.decay_ticks = 276,      // 약 200ms
+		.sustain_level = 0.0f, .release_ticks = 138, // 약 100ms
+		.state = ENV_IDLE, .level = 0.0f, .step = 0.0f };
+
+#define CONTROL_RATE   ((float) SAMPLE_RATE / (float) MOD_SUBBLOCK)
+#define LFO_RATE_MAX   (0.49f * CONTROL_RATE)   // 나이퀴스트 미만 (rate_word < 2^31)
+
+volatile Mod_Preset_t g_mod_preset = MOD_PRESET_OFF;
+
+// 활성 슬롯 비트 (Mod_SetSlot 에서 갱신 → 0 이면 보이스별 평가 생략)
+static volatile uint8_t mod_active_mask = 0;
+
+// 프리셋별 슬롯 (앞에서부터 채우고 나머지는 비움)
+#define MOD_PRESET_SLOTS  2
+static const Mod_Slot_t MOD_PRESETS[MOD_PRESET_COUNT][MOD_PRESET_SLOTS] = {
+	[MOD_PRESET_OFF] = { { MOD_SRC_NONE, MOD_DST_PITCH, 0.0f } },
+	[MOD_PRESET_VIBRATO] = { { MOD_SRC_LFO1, MOD_DST_PITCH, 15.0f } },    // ±15 cent, 5Hz
+	[MOD_PRESET_SWEEP] = { { MOD_SRC_LFO2, MOD_DST_CUTOFF, 1.5f } },      // ±1.5 옥타브, 0.5Hz
+	[MOD_PRESET_ENV2_CUTOFF] = { { MOD_SRC_ENV2, MOD_DST_CUTOFF, 2.0f } }, // 어택 때 +2 옥타브
+	[MOD_PRESET_WT_SCAN] = { { MOD_SRC_LFO2, MOD_DST_WT_POS, 0.5f } },     // 0.5 ± 0.5 → 전체 스캔
+};
+
+// S&H / 노이즈 소스용 PRNG 상태 (xorshift32)
+static uint32_t mod_seed = 22222u;
+
+// 노이즈 소스: 서브블록마다 새 랜덤값 (-1.0 ~ 1.0)
+static float mod_noise = 0.0f;
+
+void Mod_Init(void) {
+	for (int i = 0; i < MOD_NUM_LFOS; i++) {
+		g_mod_lfo[i].phase = 0;
+		g_mod_lfo[i].value = 0.0f;
+		g_mod_lfo[i].sh_value = 0.0f;
+	}
+	Mod_SetLFO(0, LFO_SINE, 5.0f);   // 비브라토/트레몰로용
+	Mod_SetLFO(1, LFO_TRI, 0.5f);    // 느린 필터 스윕용
+	Mod_SetLFO(2, LFO_SH, 8.0f);
+
+	// 기본은 라우팅 없음 (기존 사운드 유지)
+	Mod_SetPreset(MOD_PRESET_OFF);
+}
+
+void Mod_SetLFO(uint8_t idx, LFO_Shape_t shape, float rate_hz) {
+	if (idx >= MOD_NUM_LFOS)
+		return;
+	if (rate_hz < 0.0f)
+		rate_hz = 0.0f;
+	if (rate_hz > LFO_RATE_MAX)
+		rate_hz = LFO_RATE_MAX;
+
+	g_mod_lfo[idx].shape = shape;
+	// rate_word = f * 2^32 / control_rate
+	g_mod_lfo[idx].rate_word = (uint32_t) (rate_hz * (4294967296.0f / CONTROL_RATE));
+}
+
+void Mod_SetSlot(uint8_t idx, Mod_Source_t src, Mod_Dest_t dst, float amount) {
+	// 범위 밖 소스/목적지는 무시 (Mod_Eval 이 out[dst] 에 바로 씀)
+	if (idx >= MOD_NUM_SLOTS || src >= MOD_SRC_COUNT || dst >= MOD_DST_COUNT)
+		return;
+	g_mod_slots[idx].src = src;
+	g_mod_slots[idx].dst = dst;
+	g_mod_slots[idx].amount = amount;
+
+	if (src != MOD_SRC_NONE && amount != 0.0f)
+		mod_active_mask |= (uint8_t) (1u << idx);
+	else
+		mod_active_mask &= (uint8_t) ~(1u << idx);
+}
+
+void Mod_SetPreset(Mod_Preset_t preset) {
+	if (preset >= MOD_PRESET_COUNT)
+		preset = MOD_PRESET_OFF;
+
+	for (int i = 0; i < MOD_NUM_SLOTS; i++) {
+		const Mod_Slot_t *p = (i < MOD_PRESET_SLOTS) ?
+				&MOD_PRESETS[preset][i] : &MOD_PRESETS[MOD_PRESET_OFF][0];
+		Mod_SetSlot((uint8_t) i, p->src, p->dst, p->amount);
+	}
+	g_mod_preset = preset;
+}
+
+uint8_t Mod_Active(void) {
+	return mod_active_mask != 0;
+}
+
+static float lfo_sample(Mod_LFO_t *lfo, uint32_t prev_phase) {
+	uint32_t index = lfo->phase >> LUT_SHIFT;
+	const float inv_amp = 1.0f / (float) LUT_AMPLITUDE;
+
+	switch (lfo->shape) {
+	case LFO_SINE:
+		return (float) sine_lut[index] * inv_amp;
+
+	case LFO_TRI: {
+		// 톱니파를 접어서 삼각파로: tri = 2*|saw| - 1
+		float saw = (float) saw_lut[index] * inv_amp;
+		float a = (saw < 0.0f) ? -saw : saw;
+		return 2.0f * a - 1.0f;
+	}
+
+	case LFO_SAW:
+		return (float) saw_lut[index] * inv_amp;
+
+	case LFO_SH:
+		// 위상이 한 바퀴 돌 때마다 새 랜덤값
+		if (lfo->phase < prev_phase)
+			lfo->sh_value = xorshift32_bipolar(&mod_seed);
+		return lfo->sh_value;
+	}
+	return 0.0f;
+}
+
+void Mod_Tick(void) {
+	for (int i = 0; i < MOD_NUM_LFOS; i++) {
+		Mod_LFO_t *lfo = &g_mod_lfo[i];
+		uint32_t prev = lfo->phase;
+		lfo->phase += lfo->rate_word;
+		lfo->value = lfo_sample(lfo, prev);
+	}
+	mod_noise = xorshift32_bipolar(&mod_seed);
+}
+
+void Mod_EnvGate(Mod_Env_t *env, uint8_t on) {
+	if (on) {
+		env->state = ENV_ATTACK;
+		env->level = 0.0f;
+		env->step = (env->attack_ticks > 0) ?
+				1.0f / (float) env->attack_ticks : 1.0f;
+	} else if (env->state != ENV_IDLE) {
+		env->state = ENV_RELEASE;
+		env->step = (env->release_ticks > 0) ?
+				env->level / (float) env->release_ticks : env->level;
+	}
+}
+
+void Mod_EnvTick(Mod_Env_t *env) {
+	switch (env->state) {
+	case ENV_IDLE:
+		env->level = 0.0f;
+		break;
+
+	case ENV_ATTACK:
+		env->level += env->step;
+		if (env->level >= 1.0f) {
+			env->level = 1.0f;
+			env->state = ENV_DECAY;
+			env->step = (env->decay_ticks > 0) ?
+					(1.0f - env->sustain_level) / (float) env->decay_ticks :
+					(1.0f - env->sustain_level);
+		}
+		break;
+
+	case ENV_DECAY:
+		env->level -= env->step;
+		if (env->level <= env->sustain_level) {
+			env->level = env->sustain_level;
+			env->state = ENV_SUSTAIN;
+		}
+		break;
+
+	case ENV_SUSTAIN:
+		break;
+
+	case ENV_RELEASE:
+		env->level -= env->step;
+		if (env->level <= 0.0f) {
+			env->level = 0.0f;
+			env->state = ENV_IDLE;
+		}
+		break;
+	}
+}
+
+void Mod_Eval(const Mod_VoiceSrc_t *vs, float out[MOD_DST_COUNT]) {
+	for (int d = 0; d < MOD_DST_COUNT; d++)
+		out[d] = 0.0f;
+
+	for (int i = 0; i < MOD_NUM_SLOTS; i++) {
+		const Mod_Slot_t *slot = &g_mod_slots[i];
+		float v;
+
+		switch (slot->src) {
+		case MOD_SRC_LFO1:
+			v = g_mod_lfo[0].value;
+			break;
+		case MOD_SRC_LFO2:
+			v = g_mod_lfo[1].value;
+			break;
+		case MOD_SRC_LFO3:
+			v = g_mod_lfo[2].value;
+			break;
+		case MOD_SRC_ENV2:
+			v = vs->env2;
+			break;
+		case MOD_SRC_VELOCITY:
+			v = vs->velocity;
+			break;
+		case MOD_SRC_KEYTRACK:
+			v = vs->keytrack;
+			break;
+		case MOD_SRC_NOISE:
+			v = mod_noise;
+			break;
+		default:
+			continue;
+		}
+
+		out[slot->dst] += v * slot->amount;
+	}
+}
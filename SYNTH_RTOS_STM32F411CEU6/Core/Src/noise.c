@@ -0,0 +1,50 @@
+/*
+ * noise.c
+ *
+ *  노이즈 오실레이터 (화이트 / 핑크)
+ */
+
+#include "noise.h"
+#include "dsp_math.h"
+
+// 핑크 필터 출력 RMS(약 1.71)를 화이트(1/sqrt(3))에 맞추는 보정값
+#define PINK_NORM   0.337f
+
+volatile NoiseType_t g_noise_type = NOISE_OFF;
+volatile float g_noise_level = 0.3f;
+
+void Noise_Init(Noise_t *ns, uint32_t seed) {
+	ns->seed = (seed != 0) ? seed : 0x1234567u;
+	ns->b0 = 0.0f;
+	ns->b1 = 0.0f;
+	ns->b2 = 0.0f;
+}
+
+void Noise_White(Noise_t *ns, float *out, int n, float gain) {
+	uint32_t seed = ns->seed;
+	const float k = gain * (1.0f / 2147483648.0f);
+
+	for (int j = 0; j < n; j++)
+		out[j] += (float) (int32_t) xorshift32(&seed) * k;
+
+	ns->seed = seed;
+}
+
+void Noise_Pink(Noise_t *ns, float *out, int n, float gain) {
+	uint32_t seed = ns->seed;
+	float b0 = ns->b0, b1 = ns->b1, b2 = ns->b2;
+	const float k = gain * PINK_NORM;
+
+	for (int j = 0; j < n; j++) {
+		float w = xorshift32_bipolar(&seed);
+		b0 = 0.99765f * b0 + w * 0.0990460f;
+		b1 = 0.96300f * b1 + w * 0.2965164f;
+		b2 = 0.57000f * b2 + w * 1.0526913f;
+		out[j] += (b0 + b1 + b2 + w * 0.1848f) * k;
+	}
+
+	ns->seed = seed;
+	ns->b0 = b0;
+	ns->b1 = b1;
+	ns->b2 = b2;
+}
@@ -0,0 +1,20 @@
+/*
+ * pan.c
+ *
+ *  등전력 팬 테이블
+ */
+
+#include "pan.h"
+#include <math.h>
+
+uint32_t g_pan_lut[PAN_STEPS];
+
+void Pan_Init(void) {
+	// θ = 0 ~ π/2, L = √2·cos θ, R = √2·sin θ (L² + R² = 2 일정)
+	for (int i = 0; i < PAN_STEPS; i++) {
+		float th = 1.5707963f * (float) i / (float) (PAN_STEPS - 1);
+		int32_t gl = (int32_t) lrintf(1.4142136f * cosf(th) * (float) (1 << PAN_Q));
+		int32_t gr = (int32_t) lrintf(1.4142136f * sinf(th) * (float) (1 << PAN_Q));
+		g_pan_lut[i] = ((uint32_t) gl & 0xFFFFu) | ((uint32_t) gr << 16);
+	}
+}
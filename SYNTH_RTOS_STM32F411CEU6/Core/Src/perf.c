@@ -0,0 +1,129 @@
+/*
+ * perf.c
+ *
+ *  DWT 사이클 카운터 기반 성능 측정
+ *  - 오디오 블록마다 걸린 사이클을 기록하고, 데드라인(budget) 대비 사용률을 출력
+ *  - 리포트는 임계 구역에서 구간 카운터를 복사 + 초기화한 뒤 출력
+ *    (오디오 태스크가 갱신 중인 값을 읽거나, 초기화 사이에 들어온 블록을 잃지 않도록)
+ */
+
+#include "perf.h"
+#include "user_rtos.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdio.h>
+
+Perf_Block_t g_perf_audio;
+Perf_Block_t g_perf_noise;
+Perf_Block_t g_perf_mix;
+
+// Perf_BlockInit 으로 등록된 블록 (리포트 순서 = 등록 순서)
+static Perf_Block_t *perf_blocks[PERF_MAX_BLOCKS];
+static uint8_t perf_block_count = 0;
+
+void Perf_Init(void) {
+	// DWT 사이클 카운터 활성화 (디버거 없이도 동작하도록 TRCENA 먼저)
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+void Perf_BlockInit(Perf_Block_t *p, const char *name, uint32_t frames) {
+	p->name = name;
+	p->frames = frames;
+	p->budget = (uint32_t) (((uint64_t) SystemCoreClock * frames) / SAMPLE_RATE);
+	p->last = 0;
+	p->max = 0;
+	p->sum = 0;
+	p->count = 0;
+	p->overruns = 0;
+	p->units = 0;
+	p->unit = "unit";
+	p->acc_cycles = 0;
+	p->acc_units = 0;
+
+	for (uint8_t i = 0; i < perf_block_count; i++) {
+		if (perf_blocks[i] == p)
+			return;
+	}
+	// 목록이 차면 리포트에서 조용히 빠지므로 여기서 잡음 (PERF_MAX_BLOCKS 늘리기)
+	configASSERT(perf_block_count < PERF_MAX_BLOCKS);
+	if (perf_block_count < PERF_MAX_BLOCKS)
+		perf_blocks[perf_block_count++] = p;
+}
+
+void Perf_BlockSetUnit(Perf_Block_t *p, const char *unit) {
+	p->unit = unit;
+}
+
+void Perf_BlockUpdate(Perf_Block_t *p, uint32_t cycles) {
+	p->last = cycles;
+	if (cycles > p->max)
+		p->max = cycles;
+	p->sum += cycles;
+	p->count++;
+	if (cycles > p->budget)
+		p->overruns++;
+}
+
+void Perf_BlockUpdateUnits(Perf_Block_t *p, uint32_t cycles, uint32_t units) {
+	Perf_BlockUpdate(p, cycles);
+	p->units += units;
+}
+
+void Perf_BlockCommit(Perf_Block_t *p) {
+	if (p->acc_units > 0)
+		Perf_BlockUpdateUnits(p, p->acc_cycles, p->acc_units);
+	p->acc_cycles = 0;
+	p->acc_units = 0;
+}
+
+static void report_block(Perf_Block_t *p) {
+	uint32_t sum, count, units, max, overruns;
+
+	taskENTER_CRITICAL();
+	sum = p->sum;
+	count = p->count;
+	units = p->units;
+	max = p->max;
+	overruns = p->overruns;
+	// 다음 리포트 구간을 위해 초기화 (overruns는 누적 유지)
+	p->max = 0;
+	p->sum = 0;
+	p->count = 0;
+	p->units = 0;
+	taskEXIT_CRITICAL();
+
+	if (count == 0 || p->frames == 0 || p->budget == 0)
+		return;
+
+	uint32_t avg = sum / count;
+
+	// 사이클/샘플, 데드라인 대비 사용률(%)
+	printf("[PERF] %s: avg %lu cyc (%lu cyc/smp, %lu%%) max %lu cyc (%lu%%) ovr %lu\r\n",
+			p->name, (unsigned long) avg, (unsigned long) (avg / p->frames),
+			(unsigned long) ((uint64_t) avg * 100 / p->budget),
+			(unsigned long) max,
+			(unsigned long) ((uint64_t) max * 100 / p->budget),
+			(unsigned long) overruns);
+
+	// 작업량 벤치마크 (예: 오실레이터): 샘플당 평균 개수, 개수-샘플당 사이클,
+	// 같은 비용 구조로 데드라인을 꽉 채울 때의 개수 (오버헤드 포함 → 보수적)
+	if (units > 0 && sum > 0) {
+		uint32_t per_frame_x10 = (uint32_t) ((uint64_t) units * 10
+				/ ((uint64_t) count * p->frames));
+		printf("[PERF] %s: %s %lu.%lu/smp, %lu cyc/%s-smp, ~%lu %s @deadline\r\n",
+				p->name, p->unit, (unsigned long) (per_frame_x10 / 10),
+				(unsigned long) (per_frame_x10 % 10),
+				(unsigned long) (sum / units), p->unit,
+				(unsigned long) ((uint64_t) p->budget * units
+						/ ((uint64_t) sum * p->frames)), p->unit);
+	}
+}
+
+void Perf_Report(void) {
+	Printf_Lock();
+	for (uint8_t i = 0; i < perf_block_count; i++)
+		report_block(perf_blocks[i]);
+	Printf_Unlock();
+}
@@ -0,0 +1,147 @@
+/*
+ * scope.c
+ *
+ *  파형 스코프 캡처
+ *  - 공개 순서: 버퍼 다 채움 → DMB → scope_pub_idx → DMB → scope_pub_seq++
+ *  - UI 가 scope_taken_seq = scope_pub_seq 로 가져가야 다음 캡처 시작
+ *    (그 전에는 오디오 쪽 비용 0, 공개된 버퍼 인덱스도 바뀌지 않음)
+ */
+
+#include "scope.h"
+#include "ui.h"
+
+typedef enum {
+	CAP_IDLE = 0,   // UI 가 가져가길 기다림
+	CAP_ARM,        // 트리거 찾는 중
+	CAP_FILL        // 열 채우는 중
+} Cap_State_t;
+
+static Scope_Capture_t scope_buf[2];
+static volatile uint8_t scope_pub_idx;
+static volatile uint32_t scope_pub_seq;
+static volatile uint32_t scope_taken_seq;
+
+static volatile int16_t scope_trig_level = 0;
+static volatile Scope_Slope_t scope_slope = SCOPE_SLOPE_RISE;
+static volatile uint16_t scope_spp = 4;
+
+// 오디오 태스크 전용 캡처 상태
+static Cap_State_t cap_state = CAP_IDLE;
+static Scope_Capture_t *cap;
+static int16_t cap_level;
+static uint8_t cap_rise;
+static uint8_t cap_armed;         // 히스테리시스 반대편을 지났음
+static uint32_t cap_wait;         // 트리거 대기 샘플 (자동 시작 판단)
+static uint32_t cap_auto;
+static uint16_t cap_col, cap_n;
+static int16_t cap_min, cap_max;
+
+void Scope_SetTrigger(int16_t level, Scope_Slope_t slope) {
+	scope_trig_level = level;
+	scope_slope = slope;
+}
+
+void Scope_SetTimebase(uint16_t samples_per_col) {
+	if (samples_per_col < 1)
+		samples_per_col = 1;
+	if (samples_per_col > SCOPE_SPP_MAX)
+		samples_per_col = SCOPE_SPP_MAX;
+	scope_spp = samples_per_col;
+}
+
+// 새 캡처 시작 (설정은 여기서 한 번만 읽음 → 캡처 도중 바뀌어도 일관)
+static void cap_begin(void) {
+	cap = &scope_buf[scope_pub_idx ^ 1];
+	cap->spp = scope_spp;
+	cap_level = scope_trig_level;
+	cap_rise = (scope_slope == SCOPE_SLOPE_RISE);
+	cap_armed = 0;
+	cap_wait = 0;
+	cap_auto = (uint32_t) SCOPE_COLS * cap->spp;
+	if (cap_auto < SCOPE_AUTO_MIN)
+		cap_auto = SCOPE_AUTO_MIN;
+	cap_state = CAP_ARM;
+}
+
+static void cap_fill_start(uint8_t triggered) {
+	cap->triggered = triggered;
+	cap_col = 0;
+	cap_n = 0;
+	cap_state = CAP_FILL;
+}
+
+static void cap_publish(void) {
+	__DMB();
+	scope_pub_idx ^= 1;
+	__DMB();
+	scope_pub_seq++;
+	cap_state = CAP_IDLE;
+	UI_Notify(UI_EVT_WAVE);
+}
+
+void Scope_Feed(const int16_t *stereo, int frames) {
+	if (cap_state == CAP_IDLE) {
+		if (scope_taken_seq != scope_pub_seq)
+			return; // UI 가 아직 이전 캡처를 안 가져감
+		cap_begin();
+	}
+
+	for (int k = 0; k < frames; k++) {
+		const int16_t s = (int16_t) (((int32_t) stereo[2 * k]
+				+ stereo[2 * k + 1]) >> 1);
+
+		if (cap_state == CAP_ARM) {
+			// 상승: 레벨 - 히스테리시스 아래로 내려갔다가 레벨 이상 (하강은 반대)
+			if (cap_rise) {
+				if (!cap_armed)
+					cap_armed = (s < cap_level - SCOPE_TRIG_HYST);
+				else if (s >= cap_level)
+					cap_fill_start(1);
+			} else {
+				if (!cap_armed)
+					cap_armed = (s > cap_level + SCOPE_TRIG_HYST);
+				else if (s <= cap_level)
+					cap_fill_start(1);
+			}
+
+			if (cap_state == CAP_ARM) {
+				if (++cap_wait < cap_auto)
+					continue;
+				cap_fill_start(0); // 무음/DC 도 선이 보이도록
+			}
+		}
+
+		// 열당 spp 샘플의 min/max
+		if (cap_n == 0) {
+			cap_min = s;
+			cap_max = s;
+		} else if (s < cap_min) {
+			cap_min = s;
+		} else if (s > cap_max) {
+			cap_max = s;
+		}
+
+		if (++cap_n >= cap->spp) {
+			cap->lo[cap_col] = cap_min;
+			cap->hi[cap_col] = cap_max;
+			cap_n = 0;
+			if (++cap_col >= SCOPE_COLS) {
+				cap_publish();
+				return; // 남은 샘플은 버림 (다음 캡처는 UI 가 가져간 뒤)
+			}
+		}
+	}
+}
+
+const Scope_Capture_t* Scope_Acquire(void) {
+	const uint32_t s = scope_pub_seq;
+	if (s == scope_taken_seq)
+		return NULL;
+
+	__DMB();
+	const Scope_Capture_t *c = &scope_buf[scope_pub_idx];
+
+	// 반납: 오디오는 이제 반대쪽 버퍼에 다음 캡처를 씀
+	scope_taken_seq = s;
+	return c;
+}
@@ -13,6 +13,17 @@
 #include "user_rtos.h"
 #include <stdio.h>
 #include "ui.h"
+#include "perf.h"
+#include "mod.h"
+#include "dsp_math.h"
+#include "tuning.h"
+#include "fm.h"
+#include "wavetable.h"
+#include "noise.h"
+#include "pan.h"
+#include "fx_chain.h"
+#include "spectrum.h"
+#include "scope.h"
 
 // --- 설정값 정의 ---
 // Rotary 1 (Q Factor)
@@ -28,14 +39,10 @@
 #define OCTAVE_SHIFT  1
 #define SOUND_MAX 32767.0f
 #define SAMPLES_PER_MS  44  // 44.1kHz 기준 약 1ms
+#define DEFAULT_VELOCITY 100 // 키패드는 벨로시티가 없으므로 고정값 (0~127)
 
 extern I2S_HandleTypeDef hi2s1;
 
-double freq_list[] = { FREQ_C4, FREQ_D4, FREQ_E4, FREQ_F4, FREQ_G4, FREQ_A4,
-FREQ_B4 };
-
-volatile int16_t g_vis_buffer[VIS_BUF_SIZE] = { 0 };
-
 uint8_t count_arr[7] = { 0 };
 
 // --- 변수 ---
@@ -44,9 +51,9 @@ typedef enum {
 } ADSR_State_t;
 
 typedef struct {
-	float freq;
+	uint8_t note;            // MIDI 노트 번호
 	uint8_t count;
-	uint32_t phase_accumulator;
+	uint32_t phase_accumulator[UNISON_MAX]; // 오실레이터별 위상 (유니즌이 아니면 [0]만 사용)
 	uint32_t tuning_word;
 	// 설정값 (Time은 샘플 개수 단위, Level은 0.0~1.0)
 	uint32_t attack_steps;   // Attack에 걸리는 시간 (샘플 수)
@@ -58,6 +65,22 @@ typedef struct {
 	ADSR_State_t state;
 	float current_level;     // 현재 볼륨 (0.0 ~ 1.0)
 	float step_val;          // 한 샘플당 변화량 (덧셈/뺄셈)
+
+	// 모듈레이션 (서브블록마다 갱신)
+	uint8_t velocity;        // 0 ~ 127
+	Mod_Env_t env2;          // 보조 엔벨로프
+	uint32_t cur_tuning_word; // 실제 위상 증가량 (글라이드/벤드/모듈레이션 적용)
+	int32_t tw_step;         // 샘플당 cur_tuning_word 증가량 (서브블록 내 정수 램프)
+	float glide_cents;       // 목표음 기준 현재 글라이드 오프셋 (0이면 도착)
+	float glide_step;        // 서브블록당 glide_cents 감소량
+	float amp_mod;           // 앰프 모듈레이션 게인 (서브블록 내 선형 보간)
+	float amp_mod_step;
+
+	FM_Voice_t fm;           // FM 모드 오퍼레이터 상태
+	uint32_t wt_pos;         // 웨이브테이블 스캔 위치 (Q16 프레임)
+	int32_t wt_pos_step;     // 샘플당 스캔 위치 증가량 (서브블록 내 램프)
+	Noise_t noise;           // 노이즈 오실레이터 상태 (보이스마다 다른 시드)
+	int8_t pan;              // 팬 오프셋 -32(L) ~ 32(R), NoteOn 때 결정
 } ADSR_Control_t;
 
 typedef enum {
@@ -75,9 +98,6 @@ int16_t square_lut[LUT_SIZE];
 // [핵심] 현재 사용할 테이블을 가리키는 포인터 (기본값: 사인파)
 int16_t *current_lut = sine_lut;
 
-uint32_t phase_accumulator = 0;
-uint32_t tuning_word = 0;
-volatile float target_freq = 440.0f;
 TaskHandle_t audioTaskHandle = NULL;
 
 volatile float g_lpf_Q = 0.707f;
@@ -86,12 +106,15 @@ volatile uint8_t g_lpf_dirty = 1;
 
 volatile float enc_val;
 
-ADSR_Control_t basic_adsr = { .freq = FREQ_C4, .tuning_word = 0.f, .count = 0,
-		.phase_accumulator = 0, .attack_steps = 4410, // 0.1s // 현재 전송 속도 44.1KHz
+ADSR_Control_t basic_adsr = { .note = NOTE_C4, .tuning_word = 0, .count = 0,
+		.phase_accumulator = { 0 }, .attack_steps = 4410, // 0.1s // 현재 전송 속도 44.1KHz
 		.decay_steps = 4410,     // 0.1s
 		.sustain_level = 0.5f,   // 50% volume
 		.release_steps = 13230,  // 0.3s
-		.state = ADSR_IDLE, .current_level = 0.0f, .step_val = 0.0f };
+		.state = ADSR_IDLE, .current_level = 0.0f, .step_val = 0.0f,
+		.velocity = DEFAULT_VELOCITY, .cur_tuning_word = 0,
+		.tw_step = 0, .glide_cents = 0.0f, .glide_step = 0.0f, .amp_mod = 1.0f,
+		.amp_mod_step = 0.0f, .wt_pos = 0, .wt_pos_step = 0 };
 
 //ADSR_Control_t adsr = { .attack_steps = 0,    // 0.1s // 현재 전송 속도 44.1KHz
 //		.decay_steps = 2205,     // 0.1s
@@ -101,7 +124,150 @@ ADSR_Control_t basic_adsr = { .freq = FREQ_C4, .tuning_word = 0.f, .count = 0,
 
 ADSR_Control_t adsrs[MAX_VOICES];
 
-void NoteOn(void) {
+// 가장 최근에 NoteOn 된 보이스 (마스터 필터 컷오프 모듈레이션, 글라이드 시작음 기준)
+static volatile int8_t last_voice_idx = 0;
+
+volatile GlideMode_t g_glide_mode = GLIDE_OFF;
+volatile uint16_t g_glide_ms = 120;
+volatile int16_t g_pitch_bend = 0;
+
+volatile VoiceMode_t g_voice_mode = VOICE_MODE_POLY;
+volatile uint8_t g_unison_count = 5;
+volatile float g_unison_detune = 18.0f;
+volatile float g_unison_spread = 0.8f;
+
+volatile int8_t g_voice_pan[MAX_VOICES] = { 0 };
+volatile PanSpread_t g_pan_spread = PAN_SPREAD_OFF;
+volatile float g_pan_spread_amt = 0.7f;
+
+// 마스터 필터 (스테레오 → 채널별 상태, 계수는 공유)
+static BiquadTDF2 lpf_l;
+static BiquadTDF2 lpf_r;
+
+// 유니즌 위상 랜덤화용 PRNG 상태 (xorshift32)
+static uint32_t phase_seed = 12345u;
+
+void Synth_SetGlide(GlideMode_t mode, uint16_t time_ms) {
+	g_glide_mode = mode;
+	g_glide_ms = time_ms;
+}
+
+void Synth_SetVoiceMode(VoiceMode_t mode) {
+	// 웨이브테이블 모드로 들어가면 가운데 위치 + LFO2 스캔을 기본 라우팅으로,
+	// 나갈 때 그 라우팅이 그대로면 해제 (다른 프리셋을 골랐으면 유지)
+	if (mode == VOICE_MODE_WAVETABLE && g_voice_mode != VOICE_MODE_WAVETABLE) {
+		g_wt_position = 0.5f;
+		Mod_SetPreset(MOD_PRESET_WT_SCAN);
+	} else if (mode != VOICE_MODE_WAVETABLE
+			&& g_mod_preset == MOD_PRESET_WT_SCAN) {
+		Mod_SetPreset(MOD_PRESET_OFF);
+	}
+	g_voice_mode = mode;
+}
+
+void Synth_SetUnison(uint8_t count, float detune_cents, float spread) {
+	if (count < 1)
+		count = 1;
+	if (count > UNISON_MAX)
+		count = UNISON_MAX;
+	if (spread < 0.0f)
+		spread = 0.0f;
+	if (spread > 1.0f)
+		spread = 1.0f;
+	g_unison_count = count;
+	g_unison_detune = detune_cents;
+	g_unison_spread = spread;
+}
+
+void Synth_SetPan(uint8_t voice, int8_t pan) {
+	if (voice >= MAX_VOICES)
+		return;
+	if (pan < -PAN_CENTER)
+		pan = -PAN_CENTER;
+	if (pan > PAN_CENTER)
+		pan = PAN_CENTER;
+	g_voice_pan[voice] = pan;
+}
+
+void Synth_SetPanSpread(PanSpread_t mode, float amount) {
+	if (mode >= PAN_SPREAD_COUNT)
+		mode = PAN_SPREAD_OFF;
+	if (amount < 0.0f)
+		amount = 0.0f;
+	if (amount > 1.0f)
+		amount = 1.0f;
+	g_pan_spread = mode;
+	g_pan_spread_amt = amount;
+}
+
+// NoteOn 시점의 보이스 팬 (보이스별 팬 + 스프레드 모드)
+static int8_t Voice_Pan(int voice, uint8_t note) {
+	float pos = 0.0f; // -1.0 ~ 1.0
+
+	switch (g_pan_spread) {
+	case PAN_SPREAD_VOICE:
+		pos = (MAX_VOICES > 1) ?
+				2.0f * (float) voice / (float) (MAX_VOICES - 1) - 1.0f : 0.0f;
+		break;
+	case PAN_SPREAD_KEY:
+		pos = ((float) note - 60.0f) * (1.0f / 24.0f);
+		break;
+	case PAN_SPREAD_RANDOM:
+		pos = xorshift32_bipolar(&phase_seed);
+		break;
+	default:
+		break;
+	}
+	if (pos > 1.0f)
+		pos = 1.0f;
+	if (pos < -1.0f)
+		pos = -1.0f;
+
+	int pan = g_voice_pan[voice]
+			+ (int) lrintf(pos * g_pan_spread_amt * (float) PAN_CENTER);
+	if (pan < -PAN_CENTER)
+		pan = -PAN_CENTER;
+	if (pan > PAN_CENTER)
+		pan = PAN_CENTER;
+	return (int8_t) pan;
+}
+
+void Synth_SetPitchBend(int16_t value) {
+	if (value < -8192)
+		value = -8192;
+	if (value > 8191)
+		value = 8191;
+	g_pitch_bend = value;
+}
+
+static inline float Pitch_Bend_Cents(void) {
+	return (float) g_pitch_bend * ((float) PITCH_BEND_RANGE_CENTS / 8192.0f);
+}
+
+// 새 음의 글라이드 시작점 결정: 직전 보이스의 현재 tuning word (0이면 글라이드 없음)
+static uint32_t Glide_Source_Word(int8_t new_voice_idx) {
+	ADSR_Control_t *prev = &adsrs[last_voice_idx];
+
+	switch (g_glide_mode) {
+	case GLIDE_LEGATO:
+		// 다른 보이스가 아직 눌려 있는 경우만 (릴리즈/IDLE 제외)
+		for (int i = 0; i < MAX_VOICES; i++) {
+			if (i != new_voice_idx && adsrs[i].state != ADSR_IDLE
+					&& adsrs[i].state != ADSR_RELEASE) {
+				return prev->cur_tuning_word;
+			}
+		}
+		return 0;
+
+	case GLIDE_ALWAYS:
+		return prev->cur_tuning_word;
+
+	default:
+		return 0;
+	}
+}
+
+void NoteOn(uint8_t note) {
 	//adsr.state = ADSR_ATTACK;
 	// 0.0에서 1.0까지 가는데 필요한 스텝 계산
 	// 이미 소리가 나고 있는 중일 수도 있으므로 (1.0 - 현재) / steps
@@ -127,22 +293,6 @@ void NoteOn(void) {
 	}
 //    printf("New voice idx %d\n", new_voice_idx);
 
-	// [수정] 옥타브 계산 로직 추가
-	float base_freq = target_freq; // target_freq는 보통 4옥타브 기준 (예: C4 = 261.63Hz)
-	float final_freq = base_freq;
-
-	int shift = (int) g_ui_oct - 4; // 4옥타브가 기준(0)
-
-	if (shift > 0) {
-		// 옥타브 올림 (주파수 2배씩)
-		for (int k = 0; k < shift; k++)
-			final_freq *= 2.0f;
-	} else if (shift < 0) {
-		// 옥타브 내림 (주파수 절반씩)
-		for (int k = 0; k < -shift; k++)
-			final_freq *= 0.5f;
-	}
-
 	// 1. Attack (UI값 1당 약 5ms 정도로 가정)
 	adsrs[new_voice_idx].attack_steps = g_ui_adsr.attack_steps
 			* (5 * SAMPLES_PER_MS);
@@ -159,7 +309,7 @@ void NoteOn(void) {
 	adsrs[new_voice_idx].release_steps = g_ui_adsr.release_steps
 			* (5 * SAMPLES_PER_MS);
 
-	adsrs[new_voice_idx].freq = final_freq;
+	adsrs[new_voice_idx].note = note;
 	adsrs[new_voice_idx].count = ++count;
 	adsrs[new_voice_idx].state = ADSR_ATTACK;
 	// [중요] Step Value 재계산 (Attack 시간에 맞춰서)
@@ -170,8 +320,48 @@ void NoteOn(void) {
 		adsrs[new_voice_idx].step_val = 1.0f; // 즉시 최대 볼륨
 	}
 
-	adsrs[new_voice_idx].tuning_word = (uint32_t) ((double) final_freq
-			* 4294967296.0 / (double) SAMPLE_RATE);
+	// 음정 테이블 조회 1번 (12평균율 또는 로드된 Scala 스케일)
+	uint32_t new_word = Tuning_Word(note);
+	uint32_t glide_word = Glide_Source_Word(new_voice_idx);
+
+	adsrs[new_voice_idx].tuning_word = new_word;
+	adsrs[new_voice_idx].tw_step = 0;
+
+	// 글라이드: 시작 오프셋(cent)을 정해두고 서브블록마다 0까지 일정 속도로 줄임
+	uint32_t glide_ticks = ((uint32_t) g_glide_ms * SAMPLE_RATE)
+			/ (1000u * MOD_SUBBLOCK);
+	if (glide_word != 0 && glide_ticks > 0 && new_word != 0) {
+		// glide_word 에는 직전 보이스의 벤드가 이미 들어 있음
+		// → 벤드를 빼서 Update_Modulation 이 더하는 bend_cents 와 겹치지 않게
+		float cents = 1200.0f
+				* fast_log2f((float) glide_word / (float) new_word)
+				- Pitch_Bend_Cents();
+		adsrs[new_voice_idx].glide_cents = cents;
+		adsrs[new_voice_idx].glide_step = cents / (float) glide_ticks;
+		adsrs[new_voice_idx].cur_tuning_word = glide_word;
+	} else {
+		adsrs[new_voice_idx].glide_cents = 0.0f;
+		adsrs[new_voice_idx].glide_step = 0.0f;
+		adsrs[new_voice_idx].cur_tuning_word = new_word;
+		if (g_pitch_bend != 0)
+			adsrs[new_voice_idx].cur_tuning_word = (uint32_t) ((float) new_word
+					* cents_to_ratio(Pitch_Bend_Cents()));
+	}
+
+	// 모듈레이션 소스 (벨로시티 / 키 트래킹 / 보조 엔벨로프)
+	adsrs[new_voice_idx].velocity = DEFAULT_VELOCITY;
+	adsrs[new_voice_idx].env2 = g_mod_env2_preset;
+	Mod_EnvGate(&adsrs[new_voice_idx].env2, 1);
+	adsrs[new_voice_idx].pan = Voice_Pan(new_voice_idx, note);
+	last_voice_idx = new_voice_idx;
+
+	FM_NoteOn(&adsrs[new_voice_idx].fm);
+
+	// 유니즌: 오실레이터 위상을 랜덤으로 흩어서 시작 시 위상 겹침(빔) 방지
+	if (g_voice_mode == VOICE_MODE_UNISON) {
+		for (int k = 0; k < UNISON_MAX; k++)
+			adsrs[new_voice_idx].phase_accumulator[k] = xorshift32(&phase_seed);
+	}
 
 	// 어택 시작은 0부터
 	adsrs[new_voice_idx].current_level = 0.0f;
@@ -215,6 +405,8 @@ void NoteOff(void) {
 			adsrs[i].state = ADSR_RELEASE;
 			adsrs[i].step_val = adsrs[i].current_level
 					/ (float) adsrs[i].release_steps;
+			Mod_EnvGate(&adsrs[i].env2, 0);
+			FM_NoteOff(&adsrs[i].fm);
 			break;
 		}
 	}
@@ -222,7 +414,7 @@ void NoteOff(void) {
 }
 
 void Init_All_LUTs(void) {
-	int16_t amplitude = 7000; // 이게 최고 볼륭, 이론 상 최고 볼륨은 32,767
+	int16_t amplitude = LUT_AMPLITUDE; // 이게 최고 볼륭, 이론 상 최고 볼륨은 32,767
 
 	for (int i = 0; i < LUT_SIZE; i++) {
 		// 1. Sine Wave (기존과 동일)
@@ -269,132 +461,439 @@ float map_and_snap(float input_0_100, float min_val, float max_val,
 	return snapped_val;
 }
 
-void Calc_Wave_LUT(int16_t *buffer, int length) {
-	//tuning_word = (uint32_t)((double)target_freq * 4294967296.0 / (double)SAMPLE_RATE);
-
-	// ✅ 필터는 “한 번만” 초기화 (상태 유지)
-	static Biquad lpf;
-	static int inited = 0;
-
-	g_lpf_FC = map_and_snap((float)g_ui_cutoff, FC_MIN, FC_MAX, FC_STEP);
-	g_lpf_Q = map_and_snap((float)g_ui_reso, Q_MIN, Q_MAX, Q_STEP);
+// --- 유니즌 (슈퍼쏘) 테이블: 파라미터가 바뀔 때만 다시 계산 ---
+typedef struct {
+	uint8_t count;                 // 보이스당 오실레이터 수
+	float ratio[UNISON_MAX];       // 디튠 배율 (tuning word에 곱함)
+	int8_t pan_off[UNISON_MAX];    // 보이스 팬 기준 오실레이터별 팬 오프셋 (스프레드)
+	int32_t norm_q15;              // 오실레이터 수 정규화 (Q15)
+} Unison_Table_t;
+
+static Unison_Table_t uni = { .count = 1, .ratio = { 1.0f }, .pan_off = { 0 },
+		.norm_q15 = 32767 };
+
+static void Unison_Update(void) {
+	static uint8_t last_count = 0;
+	static float last_detune = -1.0f, last_spread = -1.0f;
+
+	uint8_t n = (g_voice_mode == VOICE_MODE_UNISON) ? g_unison_count : 1;
+	float detune = g_unison_detune;
+	float spread = g_unison_spread;
+
+	if (n < 1)
+		n = 1;
+	if (n > UNISON_MAX)
+		n = UNISON_MAX;
+	if (n == last_count && detune == last_detune && spread == last_spread)
+		return;
+	last_count = n;
+	last_detune = detune;
+	last_spread = spread;
+
+	// 위상이 랜덤이므로 전력 합 기준 정규화 (1/sqrt(N))
+	uni.norm_q15 = (int32_t) (32767.0f / sqrtf((float) n));
+
+	for (int k = 0; k < n; k++) {
+		// -1.0 ~ 1.0 균등 배치 (가운데 오실레이터는 디튠 0)
+		float pos = (n > 1) ? (2.0f * (float) k / (float) (n - 1) - 1.0f) : 0.0f;
+		// 좌우 번갈아 배치 → 디튠 방향과 패닝이 한쪽으로 몰리지 않게
+		float pan = ((k & 1) ? -pos : pos) * spread;
+
+		uni.ratio[k] = (pos != 0.0f) ? cents_to_ratio(pos * detune) : 1.0f;
+		uni.pan_off[k] = (int8_t) lrintf(pan * (float) PAN_CENTER);
+	}
+	uni.count = n;
+}
 
-	g_lpf_dirty = 1;
+// 서브블록마다 1회: 모듈레이션 매트릭스 평가 → 보이스 피치/앰프, 필터 컷오프 반영
+static void Update_Modulation(int frames) {
+	static float last_cutoff_oct = 0.0f;
+	float dst[MOD_DST_COUNT] = { 0.0f };
+	float cutoff_oct = 0.0f;
+	float bend_cents = Pitch_Bend_Cents();
+	// 라우팅이 없으면 LFO 진행과 보이스별 평가를 건너뜀 (dst = 0 그대로)
+	const uint8_t mod_on = Mod_Active();
+
+	if (mod_on)
+		Mod_Tick();
+	Unison_Update();
+
+	for (int v = 0; v < MAX_VOICES; v++) {
+		ADSR_Control_t *voice = &adsrs[v];
+
+		Mod_EnvTick(&voice->env2);
+		FM_Tick(&voice->fm);
+
+		if (mod_on) {
+			Mod_VoiceSrc_t vs = { .env2 = voice->env2.level, .velocity =
+					(float) voice->velocity * (1.0f / 127.0f), .keytrack =
+					(float) ((int) voice->note - NOTE_C4) * (1.0f / 12.0f) };
+			Mod_Eval(&vs, dst);
+		}
 
-	printf("%f %f\n", g_lpf_FC, g_lpf_Q);
+		// 글라이드 진행 (목표를 지나치면 0에서 멈춤)
+		if (voice->glide_cents != 0.0f) {
+			float g = voice->glide_cents - voice->glide_step;
+			if ((g > 0.0f) != (voice->glide_cents > 0.0f))
+				g = 0.0f;
+			voice->glide_cents = g;
+		}
 
-	if (!inited) {
-		biquad_reset(&lpf);
-		biquad_set_lpf(&lpf, (float) SAMPLE_RATE, g_lpf_FC, g_lpf_Q); // ✅ Fs는 SAMPLE_RATE로
-		inited = 1;
+		// 피치: 글라이드 + 벤드 + 모듈레이션(cent) → 서브블록 끝 목표 tuning word
+		float cents = voice->glide_cents + bend_cents + dst[MOD_DST_PITCH];
+		uint32_t tw_end = voice->tuning_word;
+		if (cents != 0.0f)
+			tw_end = (uint32_t) ((float) voice->tuning_word
+					* cents_to_ratio(cents));
+
+		// 현재 값에서 목표까지 정수 램프 (샘플 루프는 덧셈 1회)
+		voice->tw_step = (int32_t) (tw_end - voice->cur_tuning_word)
+				/ (int32_t) frames;
+
+		// 앰프: 목표 게인까지 서브블록 동안 선형 보간 (지퍼 노이즈 방지)
+		float gain = 1.0f + dst[MOD_DST_AMP];
+		if (gain < 0.0f)
+			gain = 0.0f;
+		if (gain > 2.0f)
+			gain = 2.0f;
+		voice->amp_mod_step = (gain - voice->amp_mod) / (float) frames;
+
+		// 웨이브테이블 스캔 위치: 기본 위치 + 모듈레이션 → 서브블록 동안 정수 램프
+		uint32_t wt_end = WT_PosToQ16(g_wavetable,
+				g_wt_position + dst[MOD_DST_WT_POS]);
+		voice->wt_pos_step = ((int32_t) wt_end - (int32_t) voice->wt_pos)
+				/ (int32_t) frames;
+
+		// 마스터 필터는 하나이므로 가장 최근 보이스 기준 (paraphonic)
+		if (v == last_voice_idx)
+			cutoff_oct = dst[MOD_DST_CUTOFF];
 	}
 
-	if (g_lpf_dirty) {
+	if (g_lpf_dirty || cutoff_oct != last_cutoff_oct) {
 		g_lpf_dirty = 0;
-		biquad_set_lpf(&lpf, (float) SAMPLE_RATE, g_lpf_FC, g_lpf_Q);
+		last_cutoff_oct = cutoff_oct;
+		float fc = g_lpf_FC;
+		if (cutoff_oct != 0.0f)
+			fc *= fast_exp2f(cutoff_oct);
+		biquad_tdf2_set_lpf(&lpf_l, (float) SAMPLE_RATE, fc, g_lpf_Q);
+		// 계수만 복사 (상태 s1/s2는 채널별 유지)
+		lpf_r.b0 = lpf_l.b0;
+		lpf_r.b1 = lpf_l.b1;
+		lpf_r.b2 = lpf_l.b2;
+		lpf_r.a1 = lpf_l.a1;
+		lpf_r.a2 = lpf_l.a2;
 	}
+}
 
-	for (int i = 0; i < length; i += 2) {
-		buffer[i] = 0;
-		buffer[i + 1] = 0;
-		float s = 0;
-		for (int voice_idx = 0; voice_idx < MAX_VOICES; voice_idx++) {
-			target_freq = adsrs[voice_idx].freq;
-			tuning_word = adsrs[voice_idx].tuning_word; //(uint32_t)((double)target_freq * 4294967296.0 / (double)SAMPLE_RATE);
-
-			// --- [1] ADSR 상태 머신 처리 ---
-			switch (adsrs[voice_idx].state) {
-			case ADSR_IDLE:
-				adsrs[voice_idx].current_level = 0.0f;
-				break;
-
-			case ADSR_ATTACK:
-				adsrs[voice_idx].current_level += adsrs[voice_idx].step_val;
-
-				if (adsrs[voice_idx].current_level >= 1.0f) {
-					adsrs[voice_idx].current_level = 1.0f;
-					adsrs[voice_idx].state = ADSR_DECAY;
-					adsrs[voice_idx].step_val = (1.0f
-							- adsrs[voice_idx].sustain_level)
-							/ (float) adsrs[voice_idx].decay_steps;
-//					printf("attack to decay\n");
-				}
-				break;
-
-			case ADSR_DECAY:
-				adsrs[voice_idx].current_level -= adsrs[voice_idx].step_val;
-				if (adsrs[voice_idx].current_level
-						<= adsrs[voice_idx].sustain_level) {
-					adsrs[voice_idx].current_level =
-							adsrs[voice_idx].sustain_level;
-					adsrs[voice_idx].state = ADSR_SUSTAIN;
-					adsrs[voice_idx].step_val = 0.0f;
-//				    printf("ADSR_DECAY to ADSR_SUSTAIN\n");
-				}
-				break;
+// ADSR 상태 머신을 n 샘플 진행 → 샘플별 게인(ADSR x 앰프 모듈레이션)을 env에 기록
+// 반환: 서브블록 전체가 무음이면 0
+static int Render_ADSR(ADSR_Control_t *voice, float *env, int n) {
+	int active = 0;
 
-			case ADSR_SUSTAIN:
-				break;
+	for (int j = 0; j < n; j++) {
+		switch (voice->state) {
+		case ADSR_IDLE:
+			voice->current_level = 0.0f;
+			break;
 
-			case ADSR_RELEASE:
-				adsrs[voice_idx].current_level -= adsrs[voice_idx].step_val;
-				if (adsrs[voice_idx].current_level <= 0.0f) {
-					adsrs[voice_idx].current_level = 0.0f;
-					adsrs[voice_idx].state = ADSR_IDLE;
-//					printf("ADSR_RELEASE to idle\n");
-				}
-				break;
+		case ADSR_ATTACK:
+			voice->current_level += voice->step_val;
+
+			if (voice->current_level >= 1.0f) {
+				voice->current_level = 1.0f;
+				voice->state = ADSR_DECAY;
+				voice->step_val = (1.0f - voice->sustain_level)
+						/ (float) voice->decay_steps;
+//				printf("attack to decay\n");
 			}
+			break;
 
-			// --- [2] 무음이면 출력 0 ---
-			if (adsrs[voice_idx].current_level <= 0.0001f) {
+		case ADSR_DECAY:
+			voice->current_level -= voice->step_val;
+			if (voice->current_level <= voice->sustain_level) {
+				voice->current_level = voice->sustain_level;
+				voice->state = ADSR_SUSTAIN;
+				voice->step_val = 0.0f;
+//			    printf("ADSR_DECAY to ADSR_SUSTAIN\n");
+			}
+			break;
 
-				adsrs[voice_idx].phase_accumulator += tuning_word;
-				continue;
+		case ADSR_SUSTAIN:
+			break;
+
+		case ADSR_RELEASE:
+			voice->current_level -= voice->step_val;
+			if (voice->current_level <= 0.0f) {
+				voice->current_level = 0.0f;
+				voice->state = ADSR_IDLE;
+//				printf("ADSR_RELEASE to idle\n");
 			}
+			break;
+		}
 
-			// --- [3] 파형 생성 + ADSR ---
-			uint32_t index = adsrs[voice_idx].phase_accumulator >> LUT_SHIFT;
-			adsrs[voice_idx].phase_accumulator += tuning_word;
+		// 무음이면 출력 0
+		if (voice->current_level <= 0.0001f) {
+			env[j] = 0.0f;
+		} else {
+			env[j] = voice->current_level * voice->amp_mod;
+			active = 1;
+		}
+		voice->amp_mod += voice->amp_mod_step;
+	}
+	return active;
+}
+
+// 보이스 하나를 n 프레임 렌더링해서 스테레오 버스에 누적
+// 반환: 렌더링한 오실레이터 x 프레임 수 (성능 측정용)
+static uint32_t Render_Voice(ADSR_Control_t *voice, float *bus_l, float *bus_r,
+		int n) {
+	static float env[MOD_SUBBLOCK];
+	static float vl[MOD_SUBBLOCK];
+	static float vr[MOD_SUBBLOCK];
+	static float nb[MOD_SUBBLOCK];
+	static int32_t acc_l[MOD_SUBBLOCK];
+	static int32_t acc_r[MOD_SUBBLOCK];
+
+	const int16_t *lut = current_lut;
+	uint32_t cur = voice->cur_tuning_word;
+	int32_t step = voice->tw_step;
+
+	// 서브블록 끝 tuning word / 스캔 위치 (램프 결과)
+	voice->cur_tuning_word = cur + (uint32_t) (step * n);
+	uint32_t wt_pos = voice->wt_pos;
+	voice->wt_pos = wt_pos + (uint32_t) (voice->wt_pos_step * n);
+
+	if (!Render_ADSR(voice, env, n)) {
+		// 무음이어도 위상은 계속 진행
+		for (int k = 0; k < uni.count; k++)
+			voice->phase_accumulator[k] += cur * (uint32_t) n;
+		return 0;
+	}
 
-			int16_t raw_val = current_lut[index];
-			s += (float) raw_val * adsrs[voice_idx].current_level; // float로 유지
+	for (int j = 0; j < n; j++) {
+		vl[j] = 0.0f;
+		vr[j] = 0.0f;
+	}
 
+	uint32_t units;
+	int mono = 1; // FM / 웨이브테이블은 모노(vl만 사용) → 보이스 팬으로 L/R 분배
+	const uint32_t pan = Pan_Gains(voice->pan);
+	const float pan_l = Pan_L(pan);
+	const float pan_r = Pan_R(pan);
+
+	switch (g_voice_mode) {
+	case VOICE_MODE_FM:
+		units = FM_Render(&voice->fm, cur, step, vl, n);
+		break;
+
+	case VOICE_MODE_WAVETABLE:
+		// 오실레이터 1개, 위상은 [0] 사용
+		WT_Render(g_wavetable, &voice->phase_accumulator[0], cur, step, wt_pos,
+				voice->wt_pos_step, vl, n);
+		units = (uint32_t) n;
+		break;
+
+	default: {
+		// 오실레이터별 L/R 게인 (Q14): 보이스 팬 + 유니즌 스프레드, 오실레이터 수 정규화
+		int16_t gl[UNISON_MAX], gr[UNISON_MAX];
+		uint32_t w0[UNISON_MAX], ws[UNISON_MAX];
+		const int count = uni.count;
+
+		for (int k = 0; k < count; k++) {
+			uint32_t g = Pan_Gains(voice->pan + uni.pan_off[k]);
+			gl[k] = (int16_t) (((int32_t) (int16_t) (g & 0xFFFFu) * uni.norm_q15) >> 15);
+			gr[k] = (int16_t) (((int32_t) (int16_t) (g >> 16) * uni.norm_q15) >> 15);
+			w0[k] = cur;
+			ws[k] = (uint32_t) step;
+			if (uni.ratio[k] != 1.0f) {
+				w0[k] = (uint32_t) ((float) cur * uni.ratio[k]);
+				ws[k] = (uint32_t) (int32_t) ((float) step * uni.ratio[k]);
+			}
 		}
-		// --- [4] ✅ IIR 필터 적용 ---
-		float x = s / 32768.0f;
-		float y = biquad_process(&lpf, x);
 
-		float out_f = y * enc_val;
-		if (out_f > 32767.0f)
-			out_f = 32767.0f;
-		if (out_f < -32768.0f)
-			out_f = -32768.0f;
+		for (int j = 0; j < n; j++) {
+			acc_l[j] = 0;
+			acc_r[j] = 0;
+		}
 
-		int16_t out = (int16_t) out_f / 2;
+		// 오실레이터 2개씩: int16 샘플 2개 패킹 → L/R 각각 SMLAD 1번 (곱셈 2 + 덧셈 2)
+		int k = 0;
+		for (; k + 1 < count; k += 2) {
+			uint32_t pa = voice->phase_accumulator[k];
+			uint32_t pb = voice->phase_accumulator[k + 1];
+			uint32_t wa = w0[k], wb = w0[k + 1];
+			const uint32_t sa = ws[k], sb = ws[k + 1];
+			const uint32_t g2l = dsp_pack16(gl[k], gl[k + 1]);
+			const uint32_t g2r = dsp_pack16(gr[k], gr[k + 1]);
+
+			for (int j = 0; j < n; j++) {
+				uint32_t s2 = dsp_pack16(lut[pa >> LUT_SHIFT], lut[pb >> LUT_SHIFT]);
+				pa += wa;
+				pb += wb;
+				wa += sa;
+				wb += sb;
+				acc_l[j] = dsp_smlad(s2, g2l, acc_l[j]);
+				acc_r[j] = dsp_smlad(s2, g2r, acc_r[j]);
+			}
+			voice->phase_accumulator[k] = pa;
+			voice->phase_accumulator[k + 1] = pb;
+		}
+		// 홀수 개면 마지막 1개
+		if (k < count) {
+			uint32_t ph = voice->phase_accumulator[k];
+			uint32_t w = w0[k];
+			const uint32_t s1 = ws[k];
+			const int32_t g1l = gl[k], g1r = gr[k];
+
+			for (int j = 0; j < n; j++) {
+				int32_t s = lut[ph >> LUT_SHIFT];
+				ph += w;
+				w += s1;
+				acc_l[j] += s * g1l;
+				acc_r[j] += s * g1r;
+			}
+			voice->phase_accumulator[k] = ph;
+		}
 
-		buffer[i] += out;
-		buffer[i + 1] += out;
+		// Q14 누적 → float (LUT 스케일)
+		for (int j = 0; j < n; j++) {
+			vl[j] = (float) acc_l[j] * (1.0f / (float) (1 << PAN_Q));
+			vr[j] = (float) acc_r[j] * (1.0f / (float) (1 << PAN_Q));
+		}
+		units = (uint32_t) count * (uint32_t) n;
+		mono = 0;
+		break;
+	}
+	}
 
+	// 노이즈 믹스 (모든 보이스 모드 공통, 보이스 팬 위치)
+	NoiseType_t nt = g_noise_type;
+	if (nt != NOISE_OFF) {
+		uint32_t t0 = Perf_Now();
+		float *dst = vl;
+		float gain = g_noise_level * (float) LUT_AMPLITUDE;
+
+		if (!mono) {
+			dst = nb;
+			for (int j = 0; j < n; j++)
+				nb[j] = 0.0f;
+		}
+		if (nt == NOISE_PINK)
+			Noise_Pink(&voice->noise, dst, n, gain);
+		else
+			Noise_White(&voice->noise, dst, n, gain);
+		if (!mono) {
+			for (int j = 0; j < n; j++) {
+				vl[j] += nb[j] * pan_l;
+				vr[j] += nb[j] * pan_r;
+			}
+		}
+		Perf_BlockAccum(&g_perf_noise, Perf_Now() - t0, (uint32_t) n);
 	}
-	int capture_len = (length / 2); // 스테레오니까 샘플 쌍의 개수
-	if (capture_len > VIS_BUF_SIZE)
-		capture_len = VIS_BUF_SIZE;
-
-	for (int k = 0; k < capture_len; k++) {
-		// buffer[2*k]는 Left 채널, buffer[2*k+1]은 Right 채널
-		// 그냥 Left만 가져옵니다.
-		g_vis_buffer[k] = buffer[2 * k];
+
+	// 스테레오 버스 누적 (모노 보이스: 읽기 2 + 버스 RMW 2, 스테레오: 읽기 3 + RMW 2)
+	uint32_t t0 = Perf_Now();
+	if (mono) {
+		for (int j = 0; j < n; j++) {
+			float s = vl[j] * env[j];
+			bus_l[j] += s * pan_l;
+			bus_r[j] += s * pan_r;
+		}
+	} else {
+		for (int j = 0; j < n; j++) {
+			bus_l[j] += vl[j] * env[j];
+			bus_r[j] += vr[j] * env[j];
+		}
 	}
+	Perf_BlockAccum(&g_perf_mix, Perf_Now() - t0, (uint32_t) n);
+	return units;
+}
 
-	static uint8_t frame_skip = 0;
+// 마스터 LPF (이펙트 체인 "filter" 스테이지, 계수는 Update_Modulation 에서 갱신)
+uint32_t Synth_Filter_Process(float *l, float *r, int n) {
+	for (int j = 0; j < n; j++) {
+		l[j] = biquad_tdf2_process(&lpf_l, l[j]);
+		r[j] = biquad_tdf2_process(&lpf_r, r[j]);
+	}
+	return (uint32_t) n;
+}
 
-	// 약 4번에 1번만 UI 업데이트 요청 (약 30~40 FPS 조절용)
-	frame_skip++;
-	if (frame_skip > 3) {
-		frame_skip = 0;
-		g_ui_dirty.wave_graph = 1; // "UI야, 그림 그려라!"
+static inline int16_t Master_Out(float y) {
+	float out_f = y * enc_val;
+	if (out_f > 32767.0f)
+		out_f = 32767.0f;
+	if (out_f < -32768.0f)
+		out_f = -32768.0f;
+
+	return (int16_t) out_f / 2;
+}
+
+void Calc_Wave_LUT(int16_t *buffer, int length) {
+	//tuning_word = (uint32_t)((double)target_freq * 4294967296.0 / (double)SAMPLE_RATE);
+
+	// ✅ 필터는 “한 번만” 초기화 (상태 유지)
+	static int inited = 0;
+	static float bus_l[MOD_SUBBLOCK];
+	static float bus_r[MOD_SUBBLOCK];
+	uint32_t osc_frames = 0;
+
+	g_lpf_FC = map_and_snap((float)g_ui_cutoff, FC_MIN, FC_MAX, FC_STEP);
+	g_lpf_Q = map_and_snap((float)g_ui_reso, Q_MIN, Q_MAX, Q_STEP);
+
+	g_lpf_dirty = 1;
+
+	uint32_t t_start = Perf_Now();
+
+	if (!inited) {
+		biquad_tdf2_reset(&lpf_l);
+		biquad_tdf2_reset(&lpf_r);
+		inited = 1;
 	}
+
+	int frames = length / 2; // 스테레오 프레임 수
+
+	for (int f = 0; f < frames; f += MOD_SUBBLOCK) {
+		int n = frames - f;
+		if (n > MOD_SUBBLOCK)
+			n = MOD_SUBBLOCK;
+
+		// 서브블록 시작마다 모듈레이션 평가 (샘플 루프 밖)
+		Update_Modulation(n);
+
+		for (int j = 0; j < n; j++) {
+			bus_l[j] = 0.0f;
+			bus_r[j] = 0.0f;
+		}
+
+		for (int voice_idx = 0; voice_idx < MAX_VOICES; voice_idx++) {
+			osc_frames += Render_Voice(&adsrs[voice_idx], bus_l, bus_r, n);
+		}
+
+		// 보이스 합 (LUT 스케일) → -1.0 ~ 1.0, 이후 이펙트 체인 (필터 포함)
+		for (int j = 0; j < n; j++) {
+			bus_l[j] *= (1.0f / 32768.0f);
+			bus_r[j] *= (1.0f / 32768.0f);
+		}
+		FX_Chain_Process(bus_l, bus_r, n);
+
+		int16_t *out = &buffer[2 * f];
+		for (int j = 0; j < n; j++) {
+			out[2 * j] = Master_Out(bus_l[j]);
+			out[2 * j + 1] = Master_Out(bus_r[j]);
+		}
+	}
+	// 합성 + 이펙트 체인 전체 사이클 측정 (시각화 복사는 제외, 스테이지별은 FX_Chain_Commit)
+	Perf_BlockUpdateUnits(&g_perf_audio, Perf_Now() - t_start, osc_frames);
+	Perf_BlockCommit(&g_perf_noise);
+	Perf_BlockCommit(&g_perf_mix);
+	FX_Chain_Commit();
+
+	// 스코프 캡처 (트리거 + min/max, 다 차면 UI_EVT_WAVE 로 LCD_Task 깨움)
+	// UI 가 이전 캡처를 가져가기 전에는 바로 반환, 갱신율은 LCD_Task 거버너가 제한
+	Scope_Feed(buffer, length / 2);
+
+	// 스펙트럼 분석 태스크로 (스펙트럼 화면일 때만, 잠금 없는 링 버퍼)
+	Spectrum_Feed(buffer, length / 2);
 }
 void StartAudioTask(void *argument) {
 
@@ -402,12 +901,32 @@ void StartAudioTask(void *argument) {
 
 	for (int i = 0; i < MAX_VOICES; i++) {
 		adsrs[i] = basic_adsr;
+		Noise_Init(&adsrs[i].noise, 0x9E3779B9u * (uint32_t) (i + 1));
 	}
 
+	// 릴리즈 꼬리에서 디노멀로 인한 CPU 스파이크 방지
+	biquad_enable_flush_to_zero();
+
+	Perf_Init();
+
+	Tuning_Init();
 	Init_All_LUTs();
+	Pan_Init();
+	Mod_Init();
+	FM_Init();
+	FX_Chain_Init();
 
 	Calc_Wave_LUT(&i2s_buffer[0], BUFFER_SIZE);
 
+	// 첫 채우기(버퍼 전체)는 데드라인과 무관하므로 측정은 여기서부터
+	Perf_BlockInit(&g_perf_audio, "audio", BUFFER_SIZE / 4); // 반 버퍼 = 스테레오 1024 프레임
+	Perf_BlockSetUnit(&g_perf_audio, "osc");
+	Perf_BlockInit(&g_perf_noise, "noise", BUFFER_SIZE / 4);
+	Perf_BlockSetUnit(&g_perf_noise, "noise");
+	Perf_BlockInit(&g_perf_mix, "mix", BUFFER_SIZE / 4);
+	Perf_BlockSetUnit(&g_perf_mix, "voice");
+	FX_Chain_PerfInit(BUFFER_SIZE / 4);
+
 	HAL_I2S_Transmit_DMA(&hi2s1, (uint16_t*) i2s_buffer, BUFFER_SIZE);
 
 	uint32_t ulNotificationValue;
@@ -458,8 +977,7 @@ void Test(void) {
 //	current_lut = saw_lut;
 //	current_lut = square_lut;
 //	// 1. 도(C4) 누르기
-//	target_freq = FREQ_C4;
-//	NoteOn();
+//	NoteOn(60);
 //	vTaskDelay(pdMS_TO_TICKS(1000));
 //
 //	// 2. 떼기
@@ -467,8 +985,7 @@ void Test(void) {
 //	vTaskDelay(pdMS_TO_TICKS(1000));
 //
 //	// 3. 미(E4) 누르기
-//	target_freq = FREQ_E4;
-//	NoteOn();
+//	NoteOn(64);
 //	vTaskDelay(pdMS_TO_TICKS(1000));
 //
 //	// 4. 떼기
@@ -476,8 +993,7 @@ void Test(void) {
 //	vTaskDelay(pdMS_TO_TICKS(1000));
 //
 //	// 5. 솔(G4)
-//	target_freq = FREQ_G4;
-//	NoteOn();
+//	NoteOn(67);
 //	vTaskDelay(pdMS_TO_TICKS(1000));
 //	NoteOff();
 	vTaskDelay(pdMS_TO_TICKS(1000));
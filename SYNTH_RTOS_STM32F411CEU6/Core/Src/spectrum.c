@@ -0,0 +1,289 @@
+/*
+ * spectrum.c
+ *
+ *  스펙트럼 분석기
+ *  - 링 버퍼: 오디오 태스크가 샘플을 쓴 뒤 쓰기 위치(spec_widx)를 공개 (DMB 후)
+ *    분석 태스크는 창을 복사한 다음 쓰기 위치를 다시 읽어, 복사 중에 덮어써졌으면 그 프레임을 버림
+ *  - 밴드 파워 = 밴드에 속한 빈 중 최대 (좁은 밴드/넓은 밴드 모두 같은 톤이면 같은 높이)
+ *  - 기준: 풀스케일 사인 + Hann 창 → 빈 크기 N/4 = 0 dBFS
+ *  - RAM: 분석 버퍼는 spec_in 하나 (실수 N점 = 복소 N/2점 제자리 FFT + 제자리 분리)
+ *    Hann 창과 분리 단계 회전 인자는 표 없이 회전 점화식으로 계산
+ */
+
+#include "spectrum.h"
+#include "ui.h"
+#include "perf.h"
+#include "dsp_math.h"
+#include "user_rtos.h"
+#include <math.h>
+#include <string.h>
+
+#if defined(ARM_MATH_CM4)
+#include "arm_math.h"
+#endif
+
+#define SPEC_TASK_STACK   256
+#define SPEC_RING_MASK    (SPEC_RING_SIZE - 1)
+
+// 링 버퍼 (오디오 태스크 → 분석 태스크)
+static int16_t spec_ring[SPEC_RING_SIZE];
+static volatile uint32_t spec_widx;      // 누적 쓰기 위치 (wrap 무관, 차이는 unsigned 뺄셈)
+static volatile uint8_t spec_enabled;
+
+// 분석 버퍼 (창 씌운 프레임 → 제자리 FFT → 빈별 파워)
+static float spec_in[SPEC_FFT_SIZE];
+static uint16_t band_k0[SPEC_BANDS], band_k1[SPEC_BANDS];   // 밴드별 빈 범위 (양 끝 포함)
+static float band_acc[SPEC_BANDS];
+
+// 스냅샷 (홀수 seq = 쓰는 중)
+static Spectrum_Snapshot_t spec_snap;
+static volatile uint32_t spec_seq;
+
+static TaskHandle_t specTaskHandle;
+static StaticTask_t spec_tcb;
+static StackType_t spec_stack[SPEC_TASK_STACK];
+
+static Perf_Block_t g_perf_fft;
+
+#if defined(ARM_MATH_CM4)
+static arm_rfft_fast_instance_f32 spec_fft;
+#endif
+
+#if !defined(ARM_MATH_CM4)
+// 타깃 외 빌드용 복소 FFT (radix-2, 제자리, 정방향, 정규화 없음 = arm_cfft_f32 와 같은 출력)
+static void cfft_host(float *z, int m) {
+	for (int i = 1, j = 0; i < m; i++) {
+		int bit = m >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j |= bit;
+		if (i < j) {
+			float t = z[2 * i];
+			z[2 * i] = z[2 * j];
+			z[2 * j] = t;
+			t = z[2 * i + 1];
+			z[2 * i + 1] = z[2 * j + 1];
+			z[2 * j + 1] = t;
+		}
+	}
+	for (int len = 2; len <= m; len <<= 1) {
+		const float a = -6.2831853f / (float) len;
+		for (int i = 0; i < m; i += len) {
+			for (int k = 0; k < len / 2; k++) {
+				float wr = cosf(a * (float) k), wi = sinf(a * (float) k);
+				float *u = &z[2 * (i + k)], *v = &z[2 * (i + k + len / 2)];
+				float tr = v[0] * wr - v[1] * wi, ti = v[0] * wi + v[1] * wr;
+				v[0] = u[0] - tr;
+				v[1] = u[1] - ti;
+				u[0] += tr;
+				u[1] += ti;
+			}
+		}
+	}
+}
+#endif
+
+// 창을 씌운 프레임(spec_in) → 빈별 파워 (0 ~ N/2-1, 0 = DC 는 0), 결과도 spec_in
+// 짝/홀 샘플을 복소수 z[n] = x[2n] + j x[2n+1] 로 묶어 M = N/2 점 FFT 후 분리:
+//   E = (Z[k] + Z*[M-k]) / 2, O = -j (Z[k] - Z*[M-k]) / 2, T = W^k O  (W = e^-j2π/N)
+//   X[k] = E + T, X[M-k] = (E - T)*  → 두 빈의 파워를 Z[k], Z[M-k] 자리에 쓰고 앞으로 모음
+static const float* spec_power(void) {
+	const int m = SPEC_FFT_SIZE / 2;
+	float *z = spec_in;
+
+#if defined(ARM_MATH_CM4)
+	// arm_rfft_fast 안의 복소 M점 인스턴스 (rfft_fast 는 출력 버퍼가 따로 필요해서 쓰지 않음)
+	arm_cfft_f32(&spec_fft.Sint, z, 0, 1);
+#else
+	cfft_host(z, m);
+#endif
+
+	// W^k 회전: (wr, wi) = (cos, -sin)(2πk/N), k = 1 부터
+	const float cr = cosf(6.2831853f / SPEC_FFT_SIZE);
+	const float ci = -sinf(6.2831853f / SPEC_FFT_SIZE);
+	float wr = cr, wi = ci;
+
+	for (int k = 1; k <= m / 2; k++) {
+		float *a = &z[2 * k], *b = &z[2 * (m - k)];
+		float er = 0.5f * (a[0] + b[0]), ei = 0.5f * (a[1] - b[1]);
+		float odr = 0.5f * (a[1] + b[1]), odi = -0.5f * (a[0] - b[0]);
+		float tr = wr * odr - wi * odi, ti = wr * odi + wi * odr;
+
+		float p0 = (er + tr) * (er + tr) + (ei + ti) * (ei + ti);
+		float p1 = (er - tr) * (er - tr) + (ei - ti) * (ei - ti);
+		a[0] = p0;
+		b[0] = p1;
+
+		float t = wr * cr - wi * ci;
+		wi = wr * ci + wi * cr;
+		wr = t;
+	}
+
+	// 파워는 z[2k] 자리 → z[k] 로 모음 (쓰는 위치 < 읽는 위치라 앞에서부터 안전)
+	for (int k = 1; k < m; k++)
+		z[k] = z[2 * k];
+	z[0] = 0.0f;
+	return z;
+}
+
+// rd - N ~ rd 구간 한 프레임 분석 → band_acc 누적, 덮어써졌으면 0
+static int spec_frame(uint32_t rd) {
+	const uint32_t start = rd - SPEC_FFT_SIZE;
+
+	// 대칭 Hann (앞쪽 절반), sample / 32768 정규화 포함
+	// cos(2πi/(N-1)) 는 회전 점화식 (512 단계 float 누적 오차 ~1e-5, 표시용으로 충분)
+	const float hr = cosf(6.2831853f / (SPEC_FFT_SIZE - 1));
+	const float hi = sinf(6.2831853f / (SPEC_FFT_SIZE - 1));
+	float c = 1.0f, sn = 0.0f;
+	for (int i = 0; i < SPEC_FFT_SIZE / 2; i++) {
+		const float w = (0.5f - 0.5f * c) * (1.0f / 32768.0f);
+		spec_in[i] = (float) spec_ring[(start + i) & SPEC_RING_MASK] * w;
+		spec_in[SPEC_FFT_SIZE - 1 - i] = (float) spec_ring[(start
+				+ SPEC_FFT_SIZE - 1 - i) & SPEC_RING_MASK] * w;
+
+		const float t = c * hr - sn * hi;
+		sn = sn * hr + c * hi;
+		c = t;
+	}
+
+	// 복사하는 동안 오디오 태스크가 창 시작점을 덮어썼는지 확인
+	__DMB();
+	if (spec_widx - start > SPEC_RING_SIZE)
+		return 0;
+
+	const float *p = spec_power();
+	for (int b = 0; b < SPEC_BANDS; b++) {
+		float m = 0.0f;
+		for (int k = band_k0[b]; k <= band_k1[b]; k++)
+			if (p[k] > m)
+				m = p[k];
+		band_acc[b] += m;
+	}
+	return 1;
+}
+
+// 평균 → dB → 레벨, 스냅샷 공개
+static void spec_publish(void) {
+	// 0 dBFS 기준 파워 (창에 1/32768 정규화 포함 → (N/4)^2), SPEC_AVG 프레임 합
+	const float ref = (float) (SPEC_FFT_SIZE / 4) * (SPEC_FFT_SIZE / 4)
+			* SPEC_AVG;
+
+	spec_seq++;
+	__DMB();
+	for (int b = 0; b < SPEC_BANDS; b++) {
+		float p = band_acc[b] / ref;
+		band_acc[b] = 0.0f;
+
+		// 10 log10(p) = 3.0103 log2(p)
+		float db = (p > 1e-12f) ? 3.0103f * fast_log2f(p) : -120.0f;
+		int lv = (int) ((db + SPEC_DB_RANGE) * (255.0f / SPEC_DB_RANGE));
+		if (lv < 0)
+			lv = 0;
+		if (lv > 255)
+			lv = 255;
+
+		// 올라갈 때는 바로, 내려갈 때는 SPEC_FALL 씩
+		int prev = spec_snap.level[b];
+		if (lv < prev - SPEC_FALL)
+			lv = prev - SPEC_FALL;
+		spec_snap.level[b] = (uint8_t) lv;
+	}
+	__DMB();
+	spec_seq++;
+}
+
+static void Spectrum_Task(void *argument) {
+	uint32_t rd = SPEC_FFT_SIZE; // 다음 프레임 끝 위치
+	int frames = 0;
+
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		uint32_t w = spec_widx;
+		// 너무 밀렸으면 (화면 꺼져 있다 켜짐 등) 최신 위치로
+		if (w - rd > SPEC_RING_SIZE - SPEC_FFT_SIZE && (int32_t) (w - rd) > 0)
+			rd = w;
+
+		while ((int32_t) (w - rd) >= 0) {
+			uint32_t t0 = Perf_Now();
+			int ok = spec_frame(rd);
+			Perf_BlockUpdate(&g_perf_fft, Perf_Now() - t0); // 오디오 선점 시간 포함
+			rd += SPEC_HOP;
+
+			if (ok && ++frames >= SPEC_AVG) {
+				frames = 0;
+				spec_publish();
+				UI_Notify(UI_EVT_SPECTRUM);
+			}
+		}
+	}
+}
+
+void Spectrum_Init(void) {
+	// 로그 간격 밴드 → 빈 범위 (좁은 저역 밴드는 최소 1빈)
+	const float bin_hz = (float) SAMPLE_RATE / SPEC_FFT_SIZE;
+	const float ratio = SPEC_F_MAX / SPEC_F_MIN;
+	for (int b = 0; b < SPEC_BANDS; b++) {
+		float f0 = SPEC_F_MIN * powf(ratio, (float) b / SPEC_BANDS);
+		float f1 = SPEC_F_MIN * powf(ratio, (float) (b + 1) / SPEC_BANDS);
+		int k0 = (int) lrintf(f0 / bin_hz);
+		int k1 = (int) lrintf(f1 / bin_hz) - 1;
+		if (k0 < 1)
+			k0 = 1;
+		if (k1 < k0)
+			k1 = k0;
+		if (k1 > SPEC_FFT_SIZE / 2 - 1)
+			k1 = SPEC_FFT_SIZE / 2 - 1;
+		band_k0[b] = (uint16_t) k0;
+		band_k1[b] = (uint16_t) k1;
+	}
+
+#if defined(ARM_MATH_CM4)
+	// 복소 N/2 점 인스턴스(Sint)만 사용
+	arm_rfft_fast_init_f32(&spec_fft, SPEC_FFT_SIZE);
+#endif
+
+	// 예산 = 홉 길이 (실시간으로 따라가려면 프레임당 이보다 작아야 함)
+	Perf_BlockInit(&g_perf_fft, "fft", SPEC_HOP);
+	Perf_BlockSetUnit(&g_perf_fft, "frame");
+
+	// 가장 낮은 사용자 우선순위 (LCD_Task 와 같음, 오디오/입력 태스크보다 낮음)
+	specTaskHandle = xTaskCreateStatic(Spectrum_Task, "Spectrum",
+	SPEC_TASK_STACK, NULL, tskIDLE_PRIORITY + 1, spec_stack, &spec_tcb);
+	configASSERT(specTaskHandle != NULL);
+}
+
+void Spectrum_Enable(uint8_t on) {
+	spec_enabled = on;
+}
+
+void Spectrum_Feed(const int16_t *stereo, int frames) {
+	if (!spec_enabled || specTaskHandle == NULL)
+		return;
+
+	uint32_t w = spec_widx;
+	for (int k = 0; k < frames; k++)
+		spec_ring[(w + k) & SPEC_RING_MASK] = (int16_t) (((int32_t) stereo[2 * k]
+				+ stereo[2 * k + 1]) >> 1);
+
+	// 샘플이 메모리에 쓰인 뒤에 위치 공개
+	__DMB();
+	spec_widx = w + (uint32_t) frames;
+	xTaskNotifyGive(specTaskHandle);
+}
+
+int Spectrum_Read(Spectrum_Snapshot_t *out, uint32_t *seq) {
+	uint32_t s = spec_seq;
+	if ((s & 1u) || s == *seq)
+		return 0;
+
+	__DMB();
+	memcpy(out, &spec_snap, sizeof(*out));
+	__DMB();
+
+	// 복사 중 갱신됐으면 다음 프레임에 다시
+	if (spec_seq != s)
+		return 0;
+	*seq = s;
+	return 1;
+}
@@ -0,0 +1,185 @@
+/*
+ * tuning.c
+ *
+ *  음정 테이블 (MIDI 노트 → tuning word)
+ *  - float/log 계산은 테이블을 만들 때만 사용 (오디오/NoteOn 경로에는 없음)
+ */
+
+#include "tuning.h"
+#include "user_rtos.h"
+#include <math.h>
+#include <stddef.h>
+
+uint32_t g_tuning_words[TUNING_NUM_NOTES];
+
+// 스케일 (cent 단위, [0] = 1번 음 ... [n-1] = 주기)
+static float scl_cents[TUNING_MAX_DEGREES];
+
+// 스케일 → tuning word 테이블 (0번 음 = TUNING_REF_NOTE, 12평균율과 같은 높이)
+static void build_table(const float *cents, int n) {
+	// 기준음 주파수: A4 기준 12평균율 C4 (약 261.63Hz)
+	const float ref_freq = TUNING_A4_FREQ
+			* exp2f((float) (TUNING_REF_NOTE - 69) / 12.0f);
+	const float period = cents[n - 1];
+
+	for (int note = 0; note < TUNING_NUM_NOTES; note++) {
+		int d = note - TUNING_REF_NOTE;
+		int oct = d / n;
+		int deg = d % n;
+		if (deg < 0) {
+			deg += n;
+			oct--;
+		}
+
+		float c = (float) oct * period + ((deg > 0) ? cents[deg - 1] : 0.0f);
+		float word = ref_freq * exp2f(c / 1200.0f)
+				* (4294967296.0f / (float) SAMPLE_RATE);
+
+		// 나이퀴스트(2^31) 이상은 잘라냄
+		// (2147483647.0f 는 float 로 2^31 이 되므로 비교/대입은 정수 쪽에서)
+		g_tuning_words[note] =
+				(word >= 2147483648.0f) ? 0x7FFFFFFFu : (uint32_t) word;
+	}
+}
+
+void Tuning_Init(void) {
+	for (int i = 0; i < 12; i++) {
+		scl_cents[i] = 100.0f * (float) (i + 1);
+	}
+	build_table(scl_cents, 12);
+}
+
+// ===== Scala 파서 =====
+
+// 주석('!')과 빈 줄을 건너뛰고 다음 줄 시작 위치 (없으면 NULL)
+static const char* next_line(const char *p) {
+	while (*p) {
+		while (*p == ' ' || *p == '\t')
+			p++;
+		if (*p == '!' || *p == '\r' || *p == '\n') {
+			while (*p && *p != '\n')
+				p++;
+			if (*p == '\n')
+				p++;
+			continue;
+		}
+		return (*p) ? p : NULL;
+	}
+	return NULL;
+}
+
+// 주석('!')만 건너뛰고 다음 줄 시작 위치 (빈 줄도 한 줄로 셈, 없으면 NULL)
+// Scala 형식에서 설명 줄은 비어 있을 수 있음
+static const char* next_text_line(const char *p) {
+	while (*p == '!') {
+		while (*p && *p != '\n')
+			p++;
+		if (*p == '\n')
+			p++;
+	}
+	return (*p) ? p : NULL;
+}
+
+static const char* skip_line(const char *p) {
+	while (*p && *p != '\n')
+		p++;
+	return (*p == '\n') ? p + 1 : p;
+}
+
+static const char* parse_uint(const char *p, uint32_t *out, int *digits) {
+	uint32_t v = 0;
+	int n = 0;
+	while (*p >= '0' && *p <= '9') {
+		if (v < 100000000u)
+			v = v * 10u + (uint32_t) (*p - '0');
+		p++;
+		n++;
+	}
+	*out = v;
+	*digits = n;
+	return p;
+}
+
+// 한 줄 값 → cent ("701.955" / "3/2" / "2")
+static int parse_degree(const char *p, float *cents) {
+	uint32_t ip, num, den;
+	int nd, neg = 0;
+
+	if (*p == '-') {
+		neg = 1;
+		p++;
+	}
+	p = parse_uint(p, &ip, &nd);
+
+	if (*p == '.') {
+		// cent 값
+		float frac = 0.0f, scale = 0.1f;
+		p++;
+		while (*p >= '0' && *p <= '9') {
+			frac += (float) (*p - '0') * scale;
+			scale *= 0.1f;
+			p++;
+		}
+		float c = (float) ip + frac;
+		*cents = neg ? -c : c;
+		return 0;
+	}
+
+	if (nd == 0 || neg)
+		return -1;
+
+	num = ip;
+	den = 1;
+	if (*p == '/') {
+		p = parse_uint(p + 1, &den, &nd);
+		if (nd == 0 || den == 0)
+			return -1;
+	}
+	if (num == 0)
+		return -1;
+
+	*cents = 1200.0f * log2f((float) num / (float) den);
+	return 0;
+}
+
+int Tuning_LoadScala(const char *scl) {
+	static float tmp[TUNING_MAX_DEGREES];
+	const char *p;
+	uint32_t n;
+	int nd;
+
+	if (scl == NULL)
+		return -1;
+
+	// 1) 설명 줄 (빈 줄 가능)
+	p = next_text_line(scl);
+	if (p == NULL)
+		return -1;
+	p = skip_line(p);
+
+	// 2) 음 개수
+	p = next_line(p);
+	if (p == NULL)
+		return -1;
+	parse_uint(p, &n, &nd);
+	if (nd == 0 || n == 0 || n > TUNING_MAX_DEGREES)
+		return -1;
+	p = skip_line(p);
+
+	// 3) 각 음 (cent 또는 비율)
+	for (uint32_t i = 0; i < n; i++) {
+		p = next_line(p);
+		if (p == NULL || parse_degree(p, &tmp[i]) != 0)
+			return -1;
+		p = skip_line(p);
+	}
+
+	// 주기가 0 이하면 옥타브 반복이 안 되므로 거부
+	if (tmp[n - 1] <= 0.0f)
+		return -1;
+
+	for (uint32_t i = 0; i < n; i++)
+		scl_cents[i] = tmp[i];
+	build_table(scl_cents, (int) n);
+	return 0;
+}
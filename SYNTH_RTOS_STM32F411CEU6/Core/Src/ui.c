@@ -2,7 +2,13 @@
 #include "main.h"
 #include "ILI9341_STM32_Driver.h"
 #include "ILI9341_GFX.h"
+#include "lcd_draw.h"
+#include "lcd_damage.h"
+#include "perf.h"
+#include "spectrum.h"
+#include "scope.h"
 #include <string.h>
+#include <stdlib.h>
 #include <math.h>
 #include "task.h"
 #include "user_rtos.h"
@@ -17,27 +23,25 @@ LcdState_t currentLcdState = LCD_STATE_GRAPH_VIEW;
 
 //uint8_t sin_samples[1024];
 
-// ===== Dirty Flags (구조체로 통합) =====
-volatile UI_DirtyFlags_t g_ui_dirty = { .full_redraw = 1, .adsr_graph = 0,
-		.adsr_sel = 0, .wave_graph = 0, .filter_sel = 0, .note_display = 0,
-		.volume_bar = 0 };
-
 // ===== UI 상태 변수 =====
 volatile UI_ADSR_t g_ui_adsr = { .attack_steps = 40, .decay_steps = 30,
 		.sustain_level = 50, .release_steps = 60 };
 
-volatile uint8_t g_ui_wave_ready = 0;
 
 volatile UI_Wave_t g_ui_wave = UI_WAVE_SINE;
 volatile UI_EditMode_t g_ui_edit_mode = UI_EDIT_ADSR;
 volatile UI_ADSR_Select_t g_adsr_sel = ADSR_SEL_A;
 volatile UI_Filter_Select_t g_filter_sel = FILTER_SEL_CUTOFF;
+volatile UI_Scope_Select_t g_scope_sel = SCOPE_SEL_TIME;
 
 volatile uint8_t g_ui_note = 0;
 volatile uint8_t g_ui_oct = 4;
 volatile uint8_t g_ui_vol = 80;
 volatile uint8_t g_ui_cutoff = 50;
 volatile uint8_t g_ui_reso = 30;
+volatile uint16_t g_ui_scope_spp = 4;
+volatile int16_t g_ui_scope_level = 0;
+volatile uint8_t g_ui_scope_fall = 0;
 
 // ===== Layout constants =====
 #define UI_M        6
@@ -85,19 +89,11 @@ volatile uint8_t g_ui_reso = 30;
 static void LCD_Task(void *argument);
 //static void Generate_Sine_Samples(void);
 static void draw_main_dashboard(void);
-static void draw_line(int x0, int y0, int x1, int y1, uint16_t color);
-
-static void draw_adsr_graph(void);
-static void draw_adsr_labels_static(void);
-static void draw_adsr_selection(void);
-
-static void draw_wave_graph(void);
+static void draw_spectrum_view(uint8_t full);
 
-static void draw_filter_labels_static(void);
-static void draw_filter_selection(void);
-
-static void draw_note_center(void);
-static void draw_volume_bar(void);
+static void scope_init(void);
+static void ui_invalidate_all(void);
+static void ui_compose(void);
 
 static void UI_MoveAdsrSelect(void);
 static void UI_ToggleFilterSelect(void);
@@ -138,6 +134,78 @@ void UI_Init(void) {
 //	}
 //}
 
+// ===== 컴포지터 =====
+// - 위젯마다 마지막으로 그린 상태를 들고 있다가, update() 에서 모델(g_ui_*)과 비교해
+//   바뀐 부분만 Damage_Add (플래그 대신 상태 비교 → 생산자 쪽 코드 불필요)
+// - 병합된 손상 영역마다 (손상 ∩ 위젯) 클립으로 draw() → 클립 밖은 전송 안 됨
+typedef struct {
+	LCD_Rect_t r;
+	void (*update)(void);
+	void (*draw)(void);
+} UI_Widget_t;
+
+// 5x5_font.h 글자 크기 (폰트 배열 중복을 피하려고 헤더는 포함하지 않음)
+#define UI_CHAR_W   6
+#define UI_CHAR_H   8
+
+volatile UI_LcdStats_t g_ui_lcd_stats;
+
+// 첫 미처리 입력 이벤트 시각 (0 = 없음), 지연 측정용
+static volatile uint32_t ui_evt_t0;
+
+// 문자열 영역 (Size 배율 포함)
+static LCD_Rect_t text_rect(const char *s, int x, int y, int size) {
+	LCD_Rect_t r = { (int16_t) x, (int16_t) y,
+			(int16_t) (x + (int) strlen(s) * UI_CHAR_W * size - 1),
+			(int16_t) (y + UI_CHAR_H * size - 1) };
+	return r;
+}
+
+static void damage_text(const char *s, int x, int y, int size) {
+	LCD_Rect_t r = text_rect(s, x, y, size);
+	Damage_Add(r.x0, r.y0, r.x1, r.y1);
+}
+
+// 같은 위치의 이전/새 문자열에서 글자가 다른 칸만 손상 (길이가 다르면 남는 칸 포함)
+// 이웃 칸은 Damage_Add 가 한 사각형으로 합침
+static void damage_text_diff(const char *old, const char *s, int x, int y,
+		int size) {
+	const int cw = UI_CHAR_W * size;
+	const int lo = (int) strlen(old), ls = (int) strlen(s);
+
+	for (int i = 0; i < lo || i < ls; i++) {
+		char a = (i < lo) ? old[i] : '\0';
+		char b = (i < ls) ? s[i] : '\0';
+		if (a != b)
+			Damage_Add(x + i * cw, y, x + (i + 1) * cw - 1,
+					y + UI_CHAR_H * size - 1);
+	}
+}
+
+// outer 에서 hole 을 뺀 부분만 채움 (글자 칸은 LCD_DrawText 가 배경까지 칠하므로 두 번 쓰지 않음)
+static void fill_around(const LCD_Rect_t *outer, const LCD_Rect_t *hole,
+		uint16_t color) {
+	LCD_Rect_t h;
+	if (!LCD_RectIntersect(outer, hole, &h)) {
+		LCD_FillRect(outer->x0, outer->y0, outer->x1, outer->y1, color);
+		return;
+	}
+	if (h.y0 > outer->y0)
+		LCD_FillRect(outer->x0, outer->y0, outer->x1, h.y0 - 1, color);
+	if (h.y1 < outer->y1)
+		LCD_FillRect(outer->x0, h.y1 + 1, outer->x1, outer->y1, color);
+	if (h.x0 > outer->x0)
+		LCD_FillRect(outer->x0, h.y0, h.x0 - 1, h.y1, color);
+	if (h.x1 < outer->x1)
+		LCD_FillRect(h.x1 + 1, h.y0, outer->x1, h.y1, color);
+}
+
+// 클립 안쪽만 그림 (문자열 전체 = 주소 창 1번)
+static void ui_text(const char *s, int x, int y, uint16_t fg, int size,
+		uint16_t bg) {
+	LCD_DrawText(s, x, y, fg, bg, size);
+}
+
 // ===== 메인 대시보드 =====
 static void draw_main_dashboard(void) {
 	ILI9341_Fill_Screen(BLACK);
@@ -154,13 +222,68 @@ static void draw_main_dashboard(void) {
 	ILI9341_Draw_Text("Press Button", 60, 195, LIGHTGREY, 1, BLACK);
 }
 
+// ===== 스펙트럼 화면 =====
+// 막대는 지난번 높이와의 차이만 그림 (올라가면 위쪽에 막대색, 내려가면 배경색)
+#define SPEC_X0     10
+#define SPEC_Y0     36
+#define SPEC_H      240
+#define SPEC_Y1     (SPEC_Y0 + SPEC_H - 1)
+#define SPEC_BAR_W  4
+#define SPEC_PITCH  5       // SPEC_BANDS x 5 = 220
+#define SPEC_X1     (SPEC_X0 + SPEC_BANDS * SPEC_PITCH - 1)
+
+static uint8_t spec_drawn[SPEC_BANDS];  // 막대 높이 (픽셀)
+static uint32_t spec_seq_drawn;
+
+static int spec_freq_x(float f) {
+	return SPEC_X0 + (int) ((float) (SPEC_BANDS * SPEC_PITCH)
+			* logf(f / SPEC_F_MIN) / logf(SPEC_F_MAX / SPEC_F_MIN));
+}
+
+static void draw_spectrum_view(uint8_t full) {
+	static const float mark_hz[] = { 100.0f, 1000.0f, 10000.0f };
+	static const char *const mark_txt[] = { "100", "1k", "10k" };
+
+	if (full) {
+		ILI9341_Fill_Screen(BLACK);
+		LCD_DrawText("SPECTRUM", SPEC_X0, 10, WHITE, BLACK, 2);
+		LCD_DrawFrame(SPEC_X0 - 2, SPEC_Y0 - 2, SPEC_X1 + 2, SPEC_Y1 + 2, WHITE);
+		for (int i = 0; i < 3; i++) {
+			int x = spec_freq_x(mark_hz[i]);
+			LCD_FillRect(x, SPEC_Y1 + 3, x, SPEC_Y1 + 6, WHITE);
+			LCD_DrawText(mark_txt[i], x - 3, SPEC_Y1 + 9, LIGHTGREY, BLACK, 1);
+		}
+		memset(spec_drawn, 0, sizeof(spec_drawn));
+		spec_seq_drawn = 0;
+	}
+
+	Spectrum_Snapshot_t snap;
+	if (!Spectrum_Read(&snap, &spec_seq_drawn))
+		return;
+
+	for (int b = 0; b < SPEC_BANDS; b++) {
+		const int h = snap.level[b] * SPEC_H / 255;
+		const int old = spec_drawn[b];
+		const int x0 = SPEC_X0 + b * SPEC_PITCH;
+		const int x1 = x0 + SPEC_BAR_W - 1;
+
+		if (h > old)
+			LCD_FillRect(x0, SPEC_Y1 - h + 1, x1, SPEC_Y1 - old, GREEN);
+		else if (h < old)
+			LCD_FillRect(x0, SPEC_Y1 - old + 1, x1, SPEC_Y1 - h, BLACK);
+		spec_drawn[b] = (uint8_t) h;
+	}
+}
+
 // ===== ADSR 그래프 =====
-static void draw_adsr_graph(void) {
-	int x0 = ADSR_X0, y0 = ADSR_Y0, w = ADSR_W, h = ADSR_H;
+#define ADSR_PTS    5
+#define ADSR_DMG_STEP  32  // 선분 손상 조각 길이 (손상 목록 12칸 안에서 가장 적게 전송)
 
-	// 프레임
-	ILI9341_Draw_Hollow_Rectangle_Coord(ADSR_X0, ADSR_Y0, ADSR_X1, ADSR_Y1,
-	WHITE);
+static int16_t adsr_px[ADSR_PTS], adsr_py[ADSR_PTS]; // 마지막으로 그린 꼭짓점
+
+// ADSR 파라미터 → 꼭짓점 (A 시작, A 끝, D 끝, S 끝, R 끝)
+static void adsr_vertices(int16_t *px, int16_t *py) {
+	int x0 = ADSR_X0, w = ADSR_W;
 
 	// ADSR 파라미터를 화면 폭으로 매핑
 	int wS = w / 4;
@@ -194,169 +317,392 @@ static void draw_adsr_graph(void) {
 		y_sus = ADSR_Y1;
 
 	// ADSR 꼭짓점
-	int xA0 = x0, yA0 = y_base;
-	int xA1 = x0 + wA, yA1 = y_peak;
-	int xD1 = xA1 + wD, yD1 = y_sus;
-	int xS1 = xD1 + wS, yS1 = y_sus;
-	int xR1 = xS1 + wR, yR1 = y_base;
-
-	if (xR1 > ADSR_X1)
-		xR1 = ADSR_X1;
-	if (xA1 > ADSR_X1)
-		xA1 = ADSR_X1;
-	if (xD1 > ADSR_X1)
-		xD1 = ADSR_X1;
-	if (xS1 > ADSR_X1)
-		xS1 = ADSR_X1;
+	int x[ADSR_PTS] = { x0, x0 + wA, x0 + wA + wD, x0 + wA + wD + wS, x0 + w };
+	int y[ADSR_PTS] = { y_base, y_peak, y_sus, y_sus, y_base };
 
-	// 선으로 그리기
-	draw_line(xA0, yA0, xA1, yA1, CYAN);
-	draw_line(xA1, yA1, xD1, yD1, CYAN);
-	int lenS = xS1 - xD1;
-	if (lenS > 0) {
-		draw_line(xD1, yD1, xS1, yD1, CYAN);
+	for (int i = 0; i < ADSR_PTS; i++) {
+		px[i] = (int16_t) ((x[i] > ADSR_X1) ? ADSR_X1 : x[i]);
+		py[i] = (int16_t) y[i];
 	}
-	draw_line(xS1, yS1, xR1, yR1, CYAN);
 }
 
-static void draw_adsr_labels_static(void) {
-	int y = ADSR_LY0;
-	ILI9341_Draw_Text("A", 40, y, LIGHTGREY, 2, BLACK);
-	ILI9341_Draw_Text("D", 90, y, LIGHTGREY, 2, BLACK);
-	ILI9341_Draw_Text("S", 140, y, LIGHTGREY, 2, BLACK);
-	ILI9341_Draw_Text("R", 190, y, LIGHTGREY, 2, BLACK);
+// 선분을 주축 방향 ADSR_DMG_STEP 픽셀 조각으로 나눠 조각별 bbox 만 손상
+// (대각선 하나의 bbox 는 대부분 배경 → 조각으로 나누면 전송 픽셀이 줄어듦)
+static void damage_line(int x0, int y0, int x1, int y1) {
+	const int dx = x1 - x0, dy = y1 - y0;
+	const int len = (abs(dx) > abs(dy)) ? abs(dx) : abs(dy);
+
+	if (len == 0) {
+		Damage_Add(x0, y0, x1, y1);
+		return;
+	}
+	// 부축은 1픽셀 여유 (Bresenham 반올림과 정수 나눗셈 버림 차이)
+	const int ex = (abs(dx) > abs(dy)) ? 0 : 1, ey = 1 - ex;
+	for (int k = 0; k < len; k += ADSR_DMG_STEP) {
+		int k1 = (k + ADSR_DMG_STEP < len) ? k + ADSR_DMG_STEP : len;
+		int xa = x0 + dx * k / len, ya = y0 + dy * k / len;
+		int xb = x0 + dx * k1 / len, yb = y0 + dy * k1 / len;
+		Damage_Add(((xa < xb) ? xa : xb) - ex, ((ya < yb) ? ya : yb) - ey,
+				((xa < xb) ? xb : xa) + ex, ((ya < yb) ? yb : ya) + ey);
+	}
+}
+
+// 바뀐 구간만 손상 처리 (이전 선분 + 새 선분의 영역)
+static void update_adsr_graph(void) {
+	int16_t px[ADSR_PTS], py[ADSR_PTS];
+	adsr_vertices(px, py);
+
+	for (int i = 0; i < ADSR_PTS - 1; i++) {
+		if (px[i] == adsr_px[i] && py[i] == adsr_py[i]
+				&& px[i + 1] == adsr_px[i + 1] && py[i + 1] == adsr_py[i + 1])
+			continue;
+		damage_line(adsr_px[i], adsr_py[i], adsr_px[i + 1], adsr_py[i + 1]);
+		damage_line(px[i], py[i], px[i + 1], py[i + 1]);
+	}
+	memcpy(adsr_px, px, sizeof(px));
+	memcpy(adsr_py, py, sizeof(py));
+}
+
+static void draw_adsr_graph(void) {
+	LCD_FillRect(ADSR_X0, ADSR_Y0, ADSR_X1, ADSR_Y1, BLACK);
+
+	// 프레임
+	LCD_DrawFrame(ADSR_X0, ADSR_Y0, ADSR_X1, ADSR_Y1, WHITE);
+
+	// 선으로 그리기
+	for (int i = 0; i < ADSR_PTS - 1; i++)
+		LCD_DrawLine(adsr_px[i], adsr_py[i], adsr_px[i + 1], adsr_py[i + 1],
+				CYAN);
+}
+
+// ===== ADSR 라벨 / 선택 =====
+static const int16_t ADSR_LABEL_X[4] = { 40, 90, 140, 190 };
+static const char *const ADSR_LABEL[4] = { "A", "D", "S", "R" };
+
+static int8_t adsr_sel_drawn = -1; // 노란 박스 위치 (-1 = 없음)
+
+static void adsr_box_damage(int sel) {
+	if (sel >= 0)
+		Damage_AddFrame(ADSR_LABEL_X[sel] - 6, ADSR_LY0, ADSR_LABEL_X[sel] + 18,
+				ADSR_LY1);
+}
+
+static void update_adsr_selection(void) {
+	// "현재 모드가 ADSR일 때만" 노란 박스 (필터 모드에서는 박스가 사라진 상태 유지)
+	int sel = (g_ui_edit_mode == UI_EDIT_ADSR) ? (int) g_adsr_sel : -1;
+	if (sel == adsr_sel_drawn)
+		return;
+
+	// 박스 테두리만 손상 → 안쪽 글씨는 겹치는 부분만 다시 그림
+	adsr_box_damage(adsr_sel_drawn);
+	adsr_box_damage(sel);
+	adsr_sel_drawn = (int8_t) sel;
 }
 
 static void draw_adsr_selection(void) {
-	int x_pos[4] = { 40, 90, 140, 190 };
+	LCD_FillRect(ADSR_X0, ADSR_LY0, ADSR_X1, ADSR_LY1, BLACK);
 
-	// 1. 배경을 지우고 글씨(A D S R)를 다시 그립니다.
-	ILI9341_Draw_Filled_Rectangle_Coord(ADSR_X0, ADSR_LY0, ADSR_X1, ADSR_LY1, BLACK);
-	draw_adsr_labels_static();
+	for (int i = 0; i < 4; i++)
+		ui_text(ADSR_LABEL[i], ADSR_LABEL_X[i], ADSR_LY0, LIGHTGREY, 2, BLACK);
 
-	// 2. [수정됨] "현재 모드가 ADSR일 때만" 노란 박스를 그립니다.
-	// 필터 모드일 때는 이 부분이 실행되지 않아 박스가 사라진 상태가 유지됩니다.
-	if (g_ui_edit_mode == UI_EDIT_ADSR) {
-		int x = x_pos[g_adsr_sel];
-		ILI9341_Draw_Hollow_Rectangle_Coord(x - 6, ADSR_LY0, x + 18, ADSR_LY1, YELLOW);
+	if (adsr_sel_drawn >= 0) {
+		int x = ADSR_LABEL_X[adsr_sel_drawn];
+		LCD_DrawFrame(x - 6, ADSR_LY0, x + 18, ADSR_LY1, YELLOW);
 	}
 }
 
 // ===== 파형 그래프 =====
-static void draw_wave_graph(void) {
-	int x0 = WAVE_X0;
-	int x1 = WAVE_X1;
-	int y0 = WAVE_Y0;
-	int y1 = WAVE_Y1;
-
-	int w = (x1 - x0 + 1); // 그래프 그릴 영역의 폭
-	int h = (y1 - y0 + 1); // 높이
-	int midY = y0 + (h / 2);
-
-	int start_idx = 0;
-
-	// 버퍼의 절반 정도까지만 검색 (안전하게)
-	for (int i = 1; i < VIS_BUF_SIZE / 2; i++) {
-		// 이전 값은 음수이고, 현재 값은 양수일 때 (상승 엣지)
-		if (g_vis_buffer[i - 1] < 0 && g_vis_buffer[i] >= 0) {
-			start_idx = i;
-			break; // 찾았으면 중단
-		}
+// 스코프 타일 팔레트 인덱스
+enum {
+	SCOPE_BG = 0, SCOPE_FRAME, SCOPE_GRID, SCOPE_TRACE
+};
+
+#define SCOPE_GRID_STEP  4
+#define SCOPE_LEVEL_STEP 128         // 트리거 레벨 한 칸 = 2 픽셀
+#define SCOPE_LEVEL_MAX  (40 * 64)   // 화면에 보이는 범위 (scope_y ±40 픽셀)
+
+static uint8_t scope_bits[LCD_TILE_BYTES(WAVE_W, WAVE_H)];
+static LCD_Tile_t scope_tile;
+
+// 열마다 마지막 파형이 차지한 행 범위 (타일 좌표, lo > hi = 비어 있음)
+static int8_t scope_lo[WAVE_W], scope_hi[WAVE_W];
+
+// 점선 = 트리거 레벨 (타일 y)
+static int scope_grid_y = WAVE_H / 2;
+
+volatile UI_FrameStats_t g_ui_scope_stats;
+
+static void scope_init(void) {
+	LCD_Tile_t *t = &scope_tile;
+
+	LCD_TileInit(t, scope_bits, WAVE_W, WAVE_H);
+	t->pal[SCOPE_BG] = BLACK;
+	t->pal[SCOPE_FRAME] = WHITE;
+	t->pal[SCOPE_GRID] = DARKGREY;
+	t->pal[SCOPE_TRACE] = CYAN;
+
+	// 프레임 및 중앙선 (점선, 트리거 레벨을 바꾸면 따라 움직임)
+	LCD_TileClear(t, SCOPE_BG);
+	LCD_TileFrame(t, SCOPE_FRAME);
+	scope_grid_y = WAVE_H / 2;
+	for (int x = 1; x < WAVE_W - 1; x += SCOPE_GRID_STEP)
+		LCD_TilePixel(t, x, scope_grid_y, SCOPE_GRID);
+
+	for (int x = 0; x < WAVE_W; x++) {
+		scope_lo[x] = 1;
+		scope_hi[x] = 0;
 	}
 
-	// 1. 프레임 및 기준선 그리기
-	ILI9341_Draw_Hollow_Rectangle_Coord(x0, y0, x1, y1, WHITE);
+	// 캡처 설정을 UI 모델 값과 맞춤
+	Scope_SetTimebase(g_ui_scope_spp);
+	Scope_SetTrigger(g_ui_scope_level,
+			g_ui_scope_fall ? SCOPE_SLOPE_FALL : SCOPE_SLOPE_RISE);
+}
+
+// 점선 한 줄 그리기 / 지우기 (파형이 지나가는 점은 그대로)
+static void scope_grid_row(int y, uint8_t idx) {
+	for (int x = 1; x < WAVE_W - 1; x += SCOPE_GRID_STEP)
+		if (y < scope_lo[x] || y > scope_hi[x])
+			LCD_TilePixel(&scope_tile, x, y, idx);
+}
 
-	// 중앙선 (점선)
-	for (int x = x0 + 1; x < x1; x += 4) {
-		ILI9341_Draw_Pixel(x, midY, DARKGREY);
+static inline void span_add(int8_t *lo, int8_t *hi, int x, int a, int b) {
+	if (a > b) {
+		int t = a;
+		a = b;
+		b = t;
 	}
+	if (lo[x] > hi[x]) {
+		lo[x] = (int8_t) a;
+		hi[x] = (int8_t) b;
+		return;
+	}
+	if (a < lo[x])
+		lo[x] = (int8_t) a;
+	if (b > hi[x])
+		hi[x] = (int8_t) b;
+}
 
-	// 2. 실제 파형 그리기
-	int prevX = x0 + 1;
-	int first_sample = g_vis_buffer[start_idx];
-	int prevY = midY - (first_sample / 800);
+// 한 열의 이전 [ol, oh] / 새 [nl, nh] 세로선 (lo > hi = 비어 있음) 에서 색이 바뀐 행 범위
+// 한쪽 끝이 같으면 움직인 끝 쪽만, 양 끝이 다 움직이면 합집합 (가운데 겹친 부분 포함, 창 1번)
+static void span_changed(int ol, int oh, int nl, int nh, int *lo, int *hi) {
+	const int o = (ol <= oh), n = (nl <= nh);
+
+	if (!o || !n) {
+		// 한쪽이 비었음 → 다른 쪽 전체 (둘 다 비었으면 lo > hi 그대로)
+		*lo = o ? ol : nl;
+		*hi = o ? oh : nh;
+	} else if (ol == nl && oh == nh) {
+		*lo = 1;
+		*hi = 0;
+	} else if (ol == nl) {
+		*lo = ((oh < nh) ? oh : nh) + 1;
+		*hi = (oh > nh) ? oh : nh;
+	} else if (oh == nh) {
+		*lo = (ol < nl) ? ol : nl;
+		*hi = ((ol > nl) ? ol : nl) - 1;
+	} else {
+		*lo = (ol < nl) ? ol : nl;
+		*hi = (oh > nh) ? oh : nh;
+	}
+}
 
-	// 루프: 화면 폭(w) 만큼 돌거나, 버퍼 데이터 끝까지
-	for (int i = 0; i < (w - 2); i++) {
-		if (i >= VIS_BUF_SIZE)
-			break; // 버퍼 오버플로우 방지
+// 새 캡처가 있으면 타일에서 이전 파형 자리만 지우고 새 파형을 그린 뒤,
+// 색이 바뀐 열 구간만 전송 (상자 전체 지우기 없음)
+static uint8_t scope_new; // LCD_Task 거버너가 스코프 갱신 슬롯에서 설정
+
+// 샘플 → 타일 y (±40 픽셀, 테두리 안쪽으로 클램프)
+static inline int scope_y(int16_t v, int midY, int h) {
+	int offset_y = -(v / 64);
+	if (offset_y > 40)
+		offset_y = 40;
+	if (offset_y < -40)
+		offset_y = -40;
+
+	int y = midY + offset_y;
+	if (y < 1)
+		y = 1;
+	if (y > h - 2)
+		y = h - 2;
+	return y;
+}
 
-		int data_idx = start_idx + i;
+// 스코프 편집 모드 표시: 프레임 색 (노랑) + 트리거 레벨 점선 위치
+static void update_scope_marks(void) {
+	LCD_Tile_t *t = &scope_tile;
 
-		if (data_idx >= VIS_BUF_SIZE)
-			break; // 버퍼 끝 체크
+	uint16_t frame = (g_ui_edit_mode == UI_EDIT_SCOPE) ? YELLOW : WHITE;
+	if (t->pal[SCOPE_FRAME] != frame) {
+		t->pal[SCOPE_FRAME] = frame;
+		Damage_AddFrame(WAVE_X0, WAVE_Y0, WAVE_X1, WAVE_Y1);
+	}
 
-		int x = x0 + 1 + i;
-		int16_t sample = g_vis_buffer[data_idx];
+	int gy = scope_y(g_ui_scope_level, WAVE_H / 2, WAVE_H);
+	if (gy != scope_grid_y) {
+		scope_grid_row(scope_grid_y, SCOPE_BG);
+		scope_grid_row(gy, SCOPE_GRID);
+		Damage_Add(WAVE_X0 + 1, WAVE_Y0 + scope_grid_y, WAVE_X1 - 1,
+				WAVE_Y0 + scope_grid_y);
+		Damage_Add(WAVE_X0 + 1, WAVE_Y0 + gy, WAVE_X1 - 1, WAVE_Y0 + gy);
+		scope_grid_y = gy;
+	}
+}
 
-		int offset_y = -(sample / 64);
+static void update_wave_graph(void) {
+	update_scope_marks();
+
+	if (!scope_new)
+		return;
+	scope_new = 0;
 
-		if (offset_y > 40)
-			offset_y = 40;
-		if (offset_y < -40)
-			offset_y = -40;
+	// 새 캡처 (트리거 정렬, 열별 min/max) 가져오기, 이 버퍼는 다음 Acquire 까지 UI 전용
+	const Scope_Capture_t *cap = Scope_Acquire();
+	if (cap == NULL)
+		return;
 
-		int y = midY + offset_y;
+	LCD_Tile_t *t = &scope_tile;
+	uint32_t t0 = Perf_Now();
+	uint32_t b0 = g_lcd_spi_stats.bytes;
+
+	// 타일 좌표 (0, 0) = (WAVE_X0, WAVE_Y0)
+	int w = WAVE_W; // 그래프 그릴 영역의 폭
+	int h = WAVE_H; // 높이
+	int midY = h / 2;
+
+	// 1. 이전 파형 지우기 (지운 자리의 점선 점은 복구)
+	for (int x = 1; x < w - 1; x++) {
+		for (int y = scope_lo[x]; y <= scope_hi[x]; y++) {
+			uint8_t idx = (y == scope_grid_y && ((x - 1) % SCOPE_GRID_STEP) == 0) ?
+					SCOPE_GRID : SCOPE_BG;
+			LCD_TilePixel(t, x, y, idx);
+		}
+	}
 
-		// 클리핑 (화면 밖으로 나가는 것 방지)
-		if (y < y0 + 1)
-			y = y0 + 1;
-		if (y > y1 - 1)
-			y = y1 - 1;
+	// 2. 열마다 min ~ max 세로선 (앞 열과 떨어져 있으면 이어지도록 늘림)
+	//    열마다 선분 영역을 기록 → 다음 프레임에 지울 범위
+	static int8_t new_lo[WAVE_W], new_hi[WAVE_W];
+	for (int x = 0; x < w; x++) {
+		new_lo[x] = 1;
+		new_hi[x] = 0;
+	}
 
-		// 선 이어 그리기
-		if (i > 0) {
-			draw_line(prevX, prevY, x, y, CYAN); // 색상을 CYAN 등으로 변경 추천
+	int pa = 0, pb = -1; // 앞 열 (늘리기 전)
+	for (int i = 0; i < SCOPE_COLS; i++) {
+		int x = 1 + i;
+		int a = scope_y(cap->hi[i], midY, h); // 최대값 = 위쪽
+		int b = scope_y(cap->lo[i], midY, h);
+		const int ca = a, cb = b;
+
+		if (pa <= pb) {
+			if (a > pb)
+				a = pb;
+			if (b < pa)
+				b = pa;
 		}
+		LCD_TileLine(t, x, a, x, b, SCOPE_TRACE);
+		span_add(new_lo, new_hi, x, a, b);
 
-		prevX = x;
-		prevY = y;
+		pa = ca;
+		pb = cb;
 	}
+
+	// 3. 열 구간 전송: 이웃 열을 붙이는 추가 픽셀 비용이 주소 창 1번보다 싸면 한 창으로
+	//    열마다 바뀐 행 = 이전 ∆ 새 세로선 (같은 열은 보내지 않음, 한쪽 끝이 같으면 그 끝은 제외)
+	LCD_Rect_t run = { 0, 0, -1, -1 };
+	for (int x = 1; x <= w - 1; x++) {
+		int lo = 1, hi = 0;
+		if (x < w - 1)
+			span_changed(scope_lo[x], scope_hi[x], new_lo[x], new_hi[x], &lo, &hi);
+
+		if (lo <= hi) {
+			LCD_Rect_t col = { (int16_t) (WAVE_X0 + x), (int16_t) (WAVE_Y0 + lo),
+					(int16_t) (WAVE_X0 + x), (int16_t) (WAVE_Y0 + hi) };
+			if (run.x0 <= run.x1) {
+				LCD_Rect_t u = LCD_RectUnion(&run, &col);
+				if (2 * (LCD_RectArea(&u) - LCD_RectArea(&run))
+						<= LCD_WINDOW_BYTES + 2 * LCD_RectArea(&col)) {
+					run = u;
+					continue;
+				}
+				LCD_SetClip(&run);
+				LCD_TileBlit(t, WAVE_X0, WAVE_Y0);
+			}
+			run = col;
+		} else if (run.x0 <= run.x1) {
+			LCD_SetClip(&run);
+			LCD_TileBlit(t, WAVE_X0, WAVE_Y0);
+			run.x1 = run.x0 - 1;
+		}
+	}
+	LCD_SetClip(NULL);
+
+	memcpy(scope_lo, new_lo, sizeof(scope_lo));
+	memcpy(scope_hi, new_hi, sizeof(scope_hi));
+
+	uint32_t cyc = Perf_Now() - t0;
+	g_ui_scope_stats.cycles = cyc;
+	if (cyc > g_ui_scope_stats.max_cycles)
+		g_ui_scope_stats.max_cycles = cyc;
+	g_ui_scope_stats.bytes = g_lcd_spi_stats.bytes - b0;
+	g_ui_scope_stats.frames++;
 }
 
-// ===== 필터 라벨 =====
-static void draw_filter_labels_static(void) {
-	int y = FILTER_LY0 + 2;
-	ILI9341_Draw_Text("CUTOFF", 32, y, LIGHTGREY, 2, BLACK);
-	ILI9341_Draw_Text("RESONANCE", 130, y, LIGHTGREY, 2, BLACK);
+// 손상 영역 다시 그리기 = 타일에서 해당 부분만 전송
+static void draw_wave_graph(void) {
+	LCD_TileBlit(&scope_tile, WAVE_X0, WAVE_Y0);
 }
 
-static void draw_filter_selection(void) {
-    int y_text = FILTER_LY0 + 2;
+// ===== 필터 라벨 / 선택 =====
+static const char *const FILTER_LABEL[2] = { "CUTOFF", "RESONANCE" };
+static const int16_t FILTER_LABEL_X[2] = { 32, 130 };
+static const int16_t FILTER_BOX_X0[2] = { 28, 126 };   // CUTOFF 텍스트 주변 박스 (X: 28 ~ 110)
+static const int16_t FILTER_BOX_X1[2] = { 110, 238 };  // RESONANCE 텍스트 주변 박스 (X: 126 ~ 238)
 
-    // 1. 해당 영역 배경 지우기
-    ILI9341_Draw_Filled_Rectangle_Coord(0, FILTER_LY0, LCD_W - 1, FILTER_LY1, BLACK);
+static int8_t filter_sel_drawn = -1; // 선택된 항목 (-1 = 필터 모드 아님)
 
-    // 2. 글씨 색상 결정 (선택된 항목만 흰색, 나머진 회색)
-    uint16_t color_cutoff = LIGHTGREY;
-    uint16_t color_reso = LIGHTGREY;
+static void filter_sel_damage(int sel) {
+	if (sel < 0)
+		return;
+	// 선택 항목은 글씨 색(흰색)과 노란 박스가 바뀜
+	damage_text(FILTER_LABEL[sel], FILTER_LABEL_X[sel], FILTER_LY0 + 2, 2);
+	Damage_AddFrame(FILTER_BOX_X0[sel], FILTER_LY0, FILTER_BOX_X1[sel],
+			FILTER_LY1);
+}
 
-    if (g_ui_edit_mode == UI_EDIT_FILTER) {
-        if (g_filter_sel == FILTER_SEL_CUTOFF) color_cutoff = WHITE;
-        else color_reso = WHITE;
-    }
+static void update_filter_selection(void) {
+	int sel = (g_ui_edit_mode == UI_EDIT_FILTER) ? (int) g_filter_sel : -1;
+	if (sel == filter_sel_drawn)
+		return;
 
-    // 3. 글씨 출력
-    // CUTOFF (X=32), RESONANCE (X=130)
-    ILI9341_Draw_Text("CUTOFF", 32, y_text, color_cutoff, 2, BLACK);
-    ILI9341_Draw_Text("RESONANCE", 130, y_text, color_reso, 2, BLACK);
+	filter_sel_damage(filter_sel_drawn);
+	filter_sel_damage(sel);
+	filter_sel_drawn = (int8_t) sel;
+}
 
-    // 4. [수정됨] 필터 모드일 때 "노란 박스" 그리기
-    if (g_ui_edit_mode == UI_EDIT_FILTER) {
-        if (g_filter_sel == FILTER_SEL_CUTOFF) {
-            // CUTOFF 텍스트 주변 박스 (X: 28 ~ 110)
-            ILI9341_Draw_Hollow_Rectangle_Coord(28, FILTER_LY0, 110, FILTER_LY1, YELLOW);
-        } else {
-            // RESONANCE 텍스트 주변 박스 (X: 126 ~ 238)
-            ILI9341_Draw_Hollow_Rectangle_Coord(126, FILTER_LY0, 238, FILTER_LY1, YELLOW);
-        }
-    }
+static void draw_filter_selection(void) {
+	LCD_FillRect(0, FILTER_LY0, LCD_W - 1, FILTER_LY1, BLACK);
+
+	// 글씨 색상 결정 (선택된 항목만 흰색, 나머진 회색)
+	for (int i = 0; i < 2; i++) {
+		uint16_t color = (i == filter_sel_drawn) ? WHITE : LIGHTGREY;
+		ui_text(FILTER_LABEL[i], FILTER_LABEL_X[i], FILTER_LY0 + 2, color, 2,
+				BLACK);
+	}
+
+	// 필터 모드일 때 "노란 박스" 그리기
+	if (filter_sel_drawn >= 0)
+		LCD_DrawFrame(FILTER_BOX_X0[filter_sel_drawn], FILTER_LY0,
+				FILTER_BOX_X1[filter_sel_drawn], FILTER_LY1, YELLOW);
 }
 
 // ===== 음계 표시 =====
-static void draw_note_center(void) {
-	static char prev[8] = { 0 };
+#define NOTE_TEXT_X     90
+#define NOTE_TEXT_Y     (NOTE_Y0 + 4)
+#define NOTE_TEXT_SIZE  4
+
+static char note_drawn[8];
+
+static void update_note_center(void) {
 	static const char *NAMES[12] = { "C", "C#", "D", "D#", "E", "F", "F#", "G",
 			"G#", "A", "A#", "B" };
 
@@ -366,65 +712,119 @@ static void draw_note_center(void) {
 
 	snprintf(buf, sizeof(buf), "%s%u", NAMES[n], (unsigned) o);
 
-	if (strcmp(prev, buf) == 0)
+	if (strcmp(note_drawn, buf) == 0)
 		return;
-	strcpy(prev, buf);
 
-	// NOTE 영역만 클리어
-	ILI9341_Draw_Filled_Rectangle_Coord(0, NOTE_Y0, LCD_W - 1, NOTE_Y1, BLACK);
+	// 바뀐 글자 칸만 (예: C4 → D4 는 첫 칸, C4 → C#4 는 둘째 칸부터)
+	damage_text_diff(note_drawn, buf, NOTE_TEXT_X, NOTE_TEXT_Y, NOTE_TEXT_SIZE);
+	strcpy(note_drawn, buf);
+}
+
+static void draw_note_center(void) {
+	static const LCD_Rect_t area = { 0, NOTE_Y0, LCD_W - 1, NOTE_Y1 };
+	LCD_Rect_t tr = text_rect(note_drawn, NOTE_TEXT_X, NOTE_TEXT_Y,
+			NOTE_TEXT_SIZE);
 
-	int x = 90;
-	int y = NOTE_Y0 + 4;
-	ILI9341_Draw_Text(buf, x, y, WHITE, 4, BLACK);
+	fill_around(&area, &tr, BLACK);
+	ui_text(note_drawn, NOTE_TEXT_X, NOTE_TEXT_Y, WHITE, NOTE_TEXT_SIZE, BLACK);
 }
 
 // ===== 볼륨 바 =====
-static void draw_volume_bar(void) {
-	int x0 = VOL_X0, x1 = VOL_X1, y0 = VOL_Y0, y1 = VOL_Y1;
-	int w = (x1 - x0 + 1);
+static int16_t vol_edge_drawn = VOL_X0; // 초록 영역 마지막 x (VOL_X0 = 비어 있음)
 
-	ILI9341_Draw_Hollow_Rectangle_Coord(x0, y0, x1, y1, WHITE);
+static int vol_edge(void) {
+	int w = (VOL_X1 - VOL_X0 + 1);
 
 	uint8_t v = g_ui_vol;
 	if (v > 100)
 		v = 100;
 
 	int fill = (w - 2) * v / 100;
+	if (fill <= 0)
+		return VOL_X0;
 
-	ILI9341_Draw_Filled_Rectangle_Coord(x0 + 1, y0 + 1, x1 - 1, y1 - 1, BLACK);
+	int xf = VOL_X0 + 1 + fill;
+	if (xf > VOL_X1 - 1)
+		xf = VOL_X1 - 1;
+	return xf;
+}
 
-	if (fill > 0) {
-		int xf = x0 + 1 + fill;
-		if (xf > x1 - 1)
-			xf = x1 - 1;
-		ILI9341_Draw_Filled_Rectangle_Coord(x0 + 1, y0 + 1, xf, y1 - 1, GREEN);
-	}
+// 이전 끝과 새 끝 사이 열만 손상
+static void update_volume_bar(void) {
+	int e = vol_edge();
+	if (e == vol_edge_drawn)
+		return;
+
+	int a = (e < vol_edge_drawn) ? e : vol_edge_drawn;
+	int b = (e < vol_edge_drawn) ? vol_edge_drawn : e;
+	Damage_Add(a + 1, VOL_Y0 + 1, b, VOL_Y1 - 1);
+	vol_edge_drawn = (int16_t) e;
 }
 
-// ===== 선 그리기 =====
-static void draw_line(int x0, int y0, int x1, int y1, uint16_t color) {
-	int dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
-	int sx = (x0 < x1) ? 1 : -1;
-	int dy = (y1 > y0) ? (y0 - y1) : (y1 - y0);
-	int sy = (y0 < y1) ? 1 : -1;
-	int err = dx + dy;
+static void draw_volume_bar(void) {
+	LCD_DrawFrame(VOL_X0, VOL_Y0, VOL_X1, VOL_Y1, WHITE);
 
-	while (1) {
-		if (x0 >= 0 && x0 < LCD_W && y0 >= 0 && y0 < LCD_H) {
-			ILI9341_Draw_Pixel((uint16_t) x0, (uint16_t) y0, color);
-		}
-		if (x0 == x1 && y0 == y1)
-			break;
-		int e2 = 2 * err;
-		if (e2 >= dy) {
-			err += dy;
-			x0 += sx;
-		}
-		if (e2 <= dx) {
-			err += dx;
-			y0 += sy;
+	// 초록 / 검정 구간이 겹치지 않게 (같은 픽셀을 두 번 칠하지 않음 → 깜빡임 없음)
+	if (vol_edge_drawn > VOL_X0)
+		LCD_FillRect(VOL_X0 + 1, VOL_Y0 + 1, vol_edge_drawn, VOL_Y1 - 1, GREEN);
+	LCD_FillRect(vol_edge_drawn + 1, VOL_Y0 + 1, VOL_X1 - 1, VOL_Y1 - 1, BLACK);
+}
+
+// ===== 위젯 목록 =====
+static const UI_Widget_t ui_widgets[] = {
+	{ { ADSR_X0, ADSR_Y0, ADSR_X1, ADSR_Y1 }, update_adsr_graph, draw_adsr_graph },
+	{ { ADSR_X0, ADSR_LY0, ADSR_X1, ADSR_LY1 }, update_adsr_selection, draw_adsr_selection },
+	{ { 0, NOTE_Y0, LCD_W - 1, NOTE_Y1 }, update_note_center, draw_note_center },
+	{ { 0, FILTER_LY0, LCD_W - 1, FILTER_LY1 }, update_filter_selection, draw_filter_selection },
+	{ { WAVE_X0, WAVE_Y0, WAVE_X1, WAVE_Y1 }, update_wave_graph, draw_wave_graph },
+	{ { VOL_X0, VOL_Y0, VOL_X1, VOL_Y1 }, update_volume_bar, draw_volume_bar },
+};
+
+#define UI_WIDGET_COUNT  (sizeof(ui_widgets) / sizeof(ui_widgets[0]))
+
+// 화면 전체 다시 그리기 (그래프 화면 진입 시)
+// 위젯 draw() 가 자기 사각형을 전부 칠하므로 화면 지우기는 위젯 밖 (사이 줄 + 좌우 여백) 만
+// 위젯 목록은 위 → 아래 순서, 세로로 겹치지 않음
+static void ui_invalidate_all(void) {
+	int y = 0;
+	for (unsigned i = 0; i < UI_WIDGET_COUNT; i++) {
+		const LCD_Rect_t *r = &ui_widgets[i].r;
+		if (r->y0 > y)
+			LCD_FillRect(0, y, LCD_W - 1, r->y0 - 1, BLACK);
+		if (r->x0 > 0)
+			LCD_FillRect(0, r->y0, r->x0 - 1, r->y1, BLACK);
+		if (r->x1 < LCD_W - 1)
+			LCD_FillRect(r->x1 + 1, r->y0, LCD_W - 1, r->y1, BLACK);
+		y = r->y1 + 1;
+	}
+	if (y < LCD_H)
+		LCD_FillRect(0, y, LCD_W - 1, LCD_H - 1, BLACK);
+
+	for (unsigned i = 0; i < UI_WIDGET_COUNT; i++) {
+		ui_widgets[i].update();
+		const LCD_Rect_t *r = &ui_widgets[i].r;
+		Damage_Add(r->x0, r->y0, r->x1, r->y1);
+	}
+}
+
+// 상태 비교 → 손상 영역 병합 → 겹치는 위젯만 클립해서 다시 그림
+static void ui_compose(void) {
+	static LCD_Rect_t dmg[DAMAGE_MAX_RECTS];
+
+	for (unsigned i = 0; i < UI_WIDGET_COUNT; i++)
+		ui_widgets[i].update();
+
+	int n = Damage_Take(dmg);
+	for (int d = 0; d < n; d++) {
+		for (unsigned i = 0; i < UI_WIDGET_COUNT; i++) {
+			LCD_Rect_t c;
+			if (!LCD_RectIntersect(&dmg[d], &ui_widgets[i].r, &c))
+				continue;
+			LCD_SetClip(&c);
+			ui_widgets[i].draw();
 		}
 	}
+	LCD_SetClip(NULL);
 }
 
 // ===== 선택 처리 로직 =====
@@ -455,8 +855,17 @@ static void UI_MoveAdsrSelect(void) {
 		if (g_filter_sel == FILTER_SEL_CUTOFF) {
 			g_filter_sel = FILTER_SEL_RESO;
 		}
-		// Resonance(마지막)이면 -> 다시 ADSR 모드(A)로 복귀!
+		// Resonance(마지막)이면 -> 스코프 모드(시간축)로 진입
 		else {
+			g_ui_edit_mode = UI_EDIT_SCOPE;
+			g_scope_sel = SCOPE_SEL_TIME;
+		}
+	}
+	// 3. 스코프 모드: 시간축 -> 트리거 레벨 -> 슬로프 -> 다시 ADSR 모드(A)로 복귀
+	else if (g_ui_edit_mode == UI_EDIT_SCOPE) {
+		if (g_scope_sel < SCOPE_SEL_SLOPE) {
+			g_scope_sel = (UI_Scope_Select_t)(g_scope_sel + 1);
+		} else {
 			g_ui_edit_mode = UI_EDIT_ADSR;
 			g_adsr_sel = ADSR_SEL_A;
 		}
@@ -467,10 +876,9 @@ static void UI_MoveAdsrSelect(void) {
 		g_adsr_sel = ADSR_SEL_A;
 	}
 
-	// [중요] 두 영역 모두 dirty 처리해야
-	// 기존 박스는 지워지고, 새로운 강조가 나타납니다.
-	g_ui_dirty.adsr_sel = 1;
-	g_ui_dirty.filter_sel = 1;
+	// 화면 갱신은 LCD_Task 컴포지터가 상태 비교로 처리
+	// (기존 박스 테두리는 지워지고, 새로운 강조가 나타납니다)
+	UI_Notify(UI_EVT_MODEL);
 }
 
 static void UI_ToggleFilterSelect(void) {
@@ -478,14 +886,12 @@ static void UI_ToggleFilterSelect(void) {
 	g_filter_sel =
 			(g_filter_sel == FILTER_SEL_CUTOFF) ?
 					FILTER_SEL_RESO : FILTER_SEL_CUTOFF;
-	g_ui_dirty.filter_sel = 1;  // ✅ 구조체 사용
+	UI_Notify(UI_EVT_MODEL);
 }
 
 static void UI_SelectVolumeMode(void) {
 	g_ui_edit_mode = UI_EDIT_VOLUME;
-	g_ui_dirty.volume_bar = 1;
-	g_ui_dirty.adsr_sel = 1;
-	g_ui_dirty.filter_sel = 1;
+	UI_Notify(UI_EVT_MODEL);
 }
 
 void UI_OnEncoderDelta(int delta) {
@@ -508,7 +914,6 @@ void UI_OnEncoderDelta(int delta) {
             g_ui_adsr.release_steps = (uint32_t) clampi((int) g_ui_adsr.release_steps + delta, 1, 200);
             break;
         }
-        g_ui_dirty.adsr_graph = 1; // 그래프 갱신
     }
     // 2. [추가됨] 필터 모드일 때 (여기가 핵심!)
     else if (g_ui_edit_mode == UI_EDIT_FILTER) {
@@ -522,16 +927,38 @@ void UI_OnEncoderDelta(int delta) {
             g_ui_reso = (uint8_t)clampi(val, 0, 100);
         }
 
-        // (선택 사항) 만약 화면에 숫자를 표시하고 있다면 여기서 UI 갱신 플래그를 켜야 함
         // 현재는 텍스트만 있으므로 변수값만 바꾸면 Sound Engine이 알아서 읽어감
-         g_ui_dirty.filter_sel = 1;
+        // (화면에 숫자를 표시하게 되면 해당 위젯 update() 에서 값 비교)
+    }
+    // 3. 스코프 모드: 다음 캡처부터 적용 (scope.c cap_begin)
+    else if (g_ui_edit_mode == UI_EDIT_SCOPE) {
+        if (g_scope_sel == SCOPE_SEL_TIME) {
+            // 한 칸마다 열당 샘플 x2 / ÷2 (1 ~ SCOPE_SPP_MAX)
+            int spp = g_ui_scope_spp;
+            for (int i = 0; i < delta && spp < SCOPE_SPP_MAX; i++)
+                spp <<= 1;
+            for (int i = 0; i > delta && spp > 1; i--)
+                spp >>= 1;
+            g_ui_scope_spp = (uint16_t) spp;
+            Scope_SetTimebase(g_ui_scope_spp);
+        } else {
+            if (g_scope_sel == SCOPE_SEL_LEVEL) {
+                int v = (int) g_ui_scope_level + delta * SCOPE_LEVEL_STEP;
+                g_ui_scope_level = (int16_t) clampi(v, -SCOPE_LEVEL_MAX, SCOPE_LEVEL_MAX);
+            } else if (delta & 1) {
+                // 한 칸마다 상승 <-> 하강
+                g_ui_scope_fall ^= 1u;
+            }
+            Scope_SetTrigger(g_ui_scope_level,
+                    g_ui_scope_fall ? SCOPE_SLOPE_FALL : SCOPE_SLOPE_RISE);
+        }
     }
-    // 3. 그 외 (볼륨 모드 등)
+    // 4. 그 외 (볼륨 모드 등)
     else {
         int v = (int) g_ui_vol + delta;
         g_ui_vol = (uint8_t) clampi(v, 0, 100);
-        g_ui_dirty.volume_bar = 1;
     }
+    UI_Notify(UI_EVT_MODEL);
 }
 
 // 1. 볼륨 변경 함수 (Rotary 2에서 호출)
@@ -545,7 +972,7 @@ void UI_OnChangeVolume(int delta) {
 		new_vol = 0;
 
 	g_ui_vol = (uint8_t) new_vol;
-	g_ui_dirty.volume_bar = 1; // 화면(볼륨 바) 갱신 요청
+	UI_Notify(UI_EVT_MODEL); // 화면(볼륨 바) 갱신 요청
 }
 
 // 2. 옥타브 변경 함수 (나중에 버튼에서 호출)
@@ -559,93 +986,170 @@ void UI_OnChangeOctave(int delta) {
 		new_oct = 1;
 
 	g_ui_oct = (uint8_t) new_oct;
-	g_ui_dirty.note_display = 1; // 화면(중앙 노트/옥타브 표시) 갱신 요청
+	UI_Notify(UI_EVT_MODEL); // 화면(중앙 노트/옥타브 표시) 갱신 요청
+}
+
+// ===== LCD 이벤트 =====
+void UI_Notify(uint32_t evt) {
+	if (lcdTaskHandle == NULL)
+		return;
+
+	if ((evt & UI_EVT_MODEL) && ui_evt_t0 == 0)
+		ui_evt_t0 = Perf_Now() | 1u;
+
+	if (xPortIsInsideInterrupt()) {
+		BaseType_t woken = pdFALSE;
+		xTaskNotifyFromISR(lcdTaskHandle, evt, eSetBits, &woken);
+		portYIELD_FROM_ISR(woken);
+	} else {
+		xTaskNotify(lcdTaskHandle, evt, eSetBits);
+	}
+}
+
+void UI_RequestScreen(LcdState_t state) {
+	uint32_t msg = (uint32_t) state;
+	if (lcdQueueHandle == NULL)
+		return;
+
+	if (xPortIsInsideInterrupt()) {
+		// 전환은 LCD_Task 가 처리하므로 문맥 전환은 UI_Notify 쪽에서
+		if (xQueueSendFromISR(lcdQueueHandle, &msg, NULL) != pdTRUE)
+			return;
+	} else if (xQueueSend(lcdQueueHandle, &msg, 0) != pdTRUE) {
+		return;
+	}
+	UI_Notify(UI_EVT_SCREEN);
 }
 
 // ===== LCD Task =====
+// - 이벤트가 없으면 블록 (폴링 없음), 통계 갱신을 위해 최대 1초마다 깨어남
+// - 거버너: 프레임 간격 ≥ 1/UI_FPS_MAX, 스코프/스펙트럼은 ≥ 1/UI_SCOPE_FPS
+//   간격 안에 들어온 이벤트는 pending 에 모았다가 다음 슬롯에서 한 번에 그림
 static void LCD_Task(void *argument) {
+	const TickType_t frame_min = pdMS_TO_TICKS(1000 / UI_FPS_MAX);
+	const TickType_t scope_min = pdMS_TO_TICKS(1000 / UI_SCOPE_FPS);
+	const TickType_t stats_period = pdMS_TO_TICKS(1000);
+	const uint32_t cyc_per_us = SystemCoreClock / 1000000u;
+
 	uint32_t received;
 	uint8_t screen_mode = LCD_STATE_GRAPH_VIEW;
 	uint8_t last_screen_mode = 255;
+	uint8_t full_redraw = 1;
+	uint32_t pending = UI_EVT_MODEL;
 
-	for (;;) {
-		if (xQueueReceive(lcdQueueHandle, &received, 0) == pdTRUE) {
-			screen_mode = (uint8_t) received;
+	TickType_t last_frame = xTaskGetTickCount() - frame_min;
+	TickType_t last_scope = last_frame - scope_min;
+	TickType_t stats_tick = xTaskGetTickCount();
+	uint32_t px_last = g_lcd_spi_stats.pixels;
+	uint32_t wakeups = 0, frames = 0, busy = 0, lat_max = 0;
 
-			if (screen_mode == LCD_STATE_GRAPH_VIEW) {
-				g_ui_dirty.full_redraw = 1;  // ✅ 구조체 사용
-			} else {
-				ILI9341_Fill_Screen(BLACK);
-			}
+	scope_init();
+
+	for (;;) {
+		// 다음 할 일까지 대기 시간 (그릴 것이 남아 있으면 다음 슬롯, 아니면 통계 주기)
+		TickType_t now = xTaskGetTickCount();
+		TickType_t frame_due = ((now - last_frame) >= frame_min) ?
+				0 : frame_min - (now - last_frame);
+		TickType_t scope_due = ((now - last_scope) >= scope_min) ?
+				0 : scope_min - (now - last_scope);
+		TickType_t wait = ((now - stats_tick) >= stats_period) ?
+				0 : stats_period - (now - stats_tick);
+		if (pending & (UI_EVT_MODEL | UI_EVT_SCREEN)) {
+			if (frame_due < wait)
+				wait = frame_due;
+		} else if (pending & (UI_EVT_WAVE | UI_EVT_SPECTRUM)) {
+			TickType_t due = (scope_due > frame_due) ? scope_due : frame_due;
+			if (due < wait)
+				wait = due;
 		}
 
-		if (screen_mode == LCD_STATE_GRAPH_VIEW) {
-			// 전체 다시 그리기
-			if (g_ui_dirty.full_redraw) {
-				g_ui_dirty.full_redraw = 0;
-
-				ILI9341_Fill_Screen(BLACK);
-				draw_adsr_graph();
-				draw_wave_graph();
-				draw_adsr_labels_static();
-				draw_adsr_selection();
-				draw_filter_selection();
-
-				// 나머지 플래그도 초기화
-				g_ui_dirty.adsr_graph = 0;
-				g_ui_dirty.adsr_sel = 0;
-				g_ui_dirty.wave_graph = 0;
-				g_ui_dirty.filter_sel = 0;
-				g_ui_dirty.note_display = 1;  // 첫 진입 시 표시
-				g_ui_dirty.volume_bar = 1;    // 첫 진입 시 표시
-			}
+		uint32_t bits = 0;
+		if (xTaskNotifyWait(0, UINT32_MAX, &bits, wait) == pdTRUE)
+			wakeups++;
+		pending |= bits;
 
-			// 부분 업데이트 (ADSR 그래프)
-			if (g_ui_dirty.adsr_graph) {
-				g_ui_dirty.adsr_graph = 0;
-				ILI9341_Draw_Filled_Rectangle_Coord(ADSR_X0, ADSR_Y0, ADSR_X1,
-				ADSR_Y1, BLACK);
-				draw_adsr_graph();
-			}
+		uint32_t t0 = Perf_Now();
+		now = xTaskGetTickCount();
 
-			// 부분 업데이트 (ADSR 선택)
-			if (g_ui_dirty.adsr_sel) {
-				g_ui_dirty.adsr_sel = 0;
-				draw_adsr_selection();
-			}
+		// 화면 전환 요청
+		if (pending & UI_EVT_SCREEN) {
+			while (xQueueReceive(lcdQueueHandle, &received, 0) == pdTRUE) {
+				screen_mode = (uint8_t) received;
 
-			// 부분 업데이트 (파형 그래프)
-			if (g_ui_dirty.wave_graph) {
-				g_ui_dirty.wave_graph = 0;
-				ILI9341_Draw_Filled_Rectangle_Coord(WAVE_X0, WAVE_Y0, WAVE_X1,
-				WAVE_Y1, BLACK);
-				draw_wave_graph();
+				if (screen_mode == LCD_STATE_GRAPH_VIEW) {
+					full_redraw = 1;
+				} else if (screen_mode != LCD_STATE_SPECTRUM_VIEW) {
+					ILI9341_Fill_Screen(BLACK);
+				}
 			}
+			currentLcdState = (LcdState_t) screen_mode;
+			Spectrum_Enable(screen_mode == LCD_STATE_SPECTRUM_VIEW);
+			pending |= UI_EVT_MODEL;
+			pending &= ~UI_EVT_SCREEN;
+		}
 
-			// 부분 업데이트 (필터 선택)
-			if (g_ui_dirty.filter_sel) {
-				g_ui_dirty.filter_sel = 0;
-				draw_filter_selection();
-			}
+		// 거버너: 편집 이벤트는 프레임 슬롯, 파형은 스코프 슬롯이 됐을 때만
+		uint8_t draw = 0;
+		if ((pending & UI_EVT_MODEL) && (now - last_frame) >= frame_min) {
+			pending &= ~UI_EVT_MODEL;
+			draw = 1;
+		}
+		if ((pending & (UI_EVT_WAVE | UI_EVT_SPECTRUM))
+				&& (now - last_scope) >= scope_min
+				&& (now - last_frame) >= frame_min) {
+			if (pending & UI_EVT_WAVE)
+				scope_new = 1;
+			pending &= ~(UI_EVT_WAVE | UI_EVT_SPECTRUM);
+			last_scope = now;
+			draw = 1;
+		}
 
-			// 부분 업데이트 (음계)
-			if (g_ui_dirty.note_display) {
-				g_ui_dirty.note_display = 0;
-				draw_note_center();
-			}
+		if (draw) {
+			uint32_t evt_t0 = ui_evt_t0;
+			ui_evt_t0 = 0;
 
-			// 부분 업데이트 (볼륨)
-			if (g_ui_dirty.volume_bar) {
-				g_ui_dirty.volume_bar = 0;
-				draw_volume_bar();
+			if (screen_mode == LCD_STATE_GRAPH_VIEW) {
+				// 전체 다시 그리기 (모든 위젯 영역을 손상 처리)
+				if (full_redraw) {
+					full_redraw = 0;
+					ui_invalidate_all();
+				}
+
+				// 바뀐 부분만 다시 그리기
+				ui_compose();
+			} else if (screen_mode == LCD_STATE_SPECTRUM_VIEW) {
+				draw_spectrum_view(screen_mode != last_screen_mode);
+			} else if (screen_mode != last_screen_mode) {
+				if (screen_mode == LCD_STATE_MAIN_DASH)
+					draw_main_dashboard();
 			}
-		} else if (screen_mode != last_screen_mode) {
-			if (screen_mode == LCD_STATE_MAIN_DASH)
-				draw_main_dashboard();
 			last_screen_mode = screen_mode;
-		}
+			ILI9341_Flush();
+
+			last_frame = now;
+			frames++;
 
-		vTaskDelay(pdMS_TO_TICKS(30));
+			// 입력 → 전송 완료 지연
+			if (evt_t0) {
+				uint32_t lat = (Perf_Now() - evt_t0) / cyc_per_us;
+				g_ui_lcd_stats.latency_us_last = lat;
+				if (lat > lat_max)
+					lat_max = lat;
+			}
+		}
+		busy += Perf_Now() - t0;
+
+		// 1초 통계 (초당 전송 픽셀, 깨어난 횟수, 점유율)
+		if ((now - stats_tick) >= stats_period) {
+			stats_tick = now;
+			g_ui_lcd_stats.wakeups = wakeups;
+			g_ui_lcd_stats.frames = frames;
+			g_ui_lcd_stats.load_permille = busy / (SystemCoreClock / 1000u);
+			g_ui_lcd_stats.px = g_lcd_spi_stats.pixels - px_last;
+			g_ui_lcd_stats.latency_us_max = lat_max;
+			px_last = g_lcd_spi_stats.pixels;
+			wakeups = frames = busy = lat_max = 0;
+		}
 	}
 }
 
@@ -661,8 +1165,12 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_PIN) {
 		UI_MoveAdsrSelect();
 		return;
 	}
-//
-//	if (GPIO_PIN == Rotary2_KEY_Pin) {
-//		return; // 화면 전환 막고 옥타브만 테스트하려면 return
-//	}
+
+	// 파형 화면 ↔ 스펙트럼 화면
+	if (GPIO_PIN == Rotary2_KEY_Pin) {
+		UI_RequestScreen(
+				(currentLcdState == LCD_STATE_SPECTRUM_VIEW) ?
+						LCD_STATE_GRAPH_VIEW : LCD_STATE_SPECTRUM_VIEW);
+		return;
+	}
 }
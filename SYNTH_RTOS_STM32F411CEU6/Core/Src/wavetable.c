@@ -0,0 +1,50 @@
+/*
+ * wavetable.c
+ *
+ *  웨이브테이블 오실레이터
+ *  - 테이블은 const (플래시), 렌더링 중 RAM 사용 없음
+ */
+
+#include "wavetable.h"
+
+const Wavetable_t *g_wavetable = &g_wt_default;
+volatile float g_wt_position = 0.0f;
+
+uint32_t WT_PosToQ16(const Wavetable_t *wt, float pos) {
+	if (wt->num_frames < 2)
+		return 0;
+
+	const uint32_t max_q16 = ((uint32_t) (wt->num_frames - 1) << 16) - 1;
+
+	if (pos <= 0.0f)
+		return 0;
+	if (pos >= 1.0f)
+		return max_q16;
+
+	uint32_t q = (uint32_t) (pos * (float) (wt->num_frames - 1) * 65536.0f);
+	return (q > max_q16) ? max_q16 : q;
+}
+
+void WT_Render(const Wavetable_t *wt, uint32_t *phase, uint32_t word,
+		int32_t step, uint32_t pos, int32_t pos_step, float *out, int n) {
+	const int16_t *data = wt->data;
+	uint32_t ph = *phase;
+	uint32_t w = word;
+
+	for (int j = 0; j < n; j++) {
+		uint32_t idx = ph >> WT_SHIFT;
+		const int16_t *f0 = data + ((pos >> 16) << WT_FRAME_BITS);
+
+		// 현재 프레임 a, 다음 프레임 b 사이 정수 보간 (frac: Q15)
+		int32_t a = f0[idx];
+		int32_t b = f0[idx + WT_FRAME_SIZE];
+		int32_t frac = (int32_t) ((pos >> 1) & 0x7FFF);
+
+		out[j] += (float) (a + (((b - a) * frac) >> 15));
+
+		ph += w;
+		w += (uint32_t) step;
+		pos += (uint32_t) pos_step;
+	}
+	*phase = ph;
+}
@@ -0,0 +1,153 @@
+/*
+ * wavetable_data.c
+ *
+ *  Tools/wav2wt.c 로 생성된 웨이브테이블 (직접 수정하지 말 것)
+ *  8 프레임 x 256 샘플 (재생성 방법은 Tools/wav2wt.c 참고)
+ */
+
+#include "wavetable.h"
+
+#if WT_FRAME_SIZE != 256
+#error "WT_FRAME_SIZE mismatch"
+#endif
+
+static const int16_t g_wt_default_data[8 * WT_FRAME_SIZE] = {
+	// frame 0
+	0, 172, 343, 515, 686, 857, 1027, 1197, 1366, 1534, 1701, 1867, 2032, 2196, 2358, 2519,
+	2679, 2837, 2993, 3147, 3300, 3450, 3599, 3745, 3889, 4031, 4170, 4307, 4441, 4572, 4701, 4827,
+	4950, 5070, 5187, 5300, 5411, 5518, 5622, 5723, 5820, 5914, 6004, 6091, 6173, 6253, 6328, 6399,
+	6467, 6531, 6591, 6647, 6699, 6746, 6790, 6830, 6865, 6897, 6924, 6947, 6966, 6981, 6992, 6998,
+	7000, 6998, 6992, 6981, 6966, 6947, 6924, 6897, 6865, 6830, 6790, 6746, 6699, 6647, 6591, 6531,
+	6467, 6399, 6328, 6253, 6173, 6091, 6004, 5914, 5820, 5723, 5622, 5518, 5411, 5300, 5187, 5070,
+	4950, 4827, 4701, 4572, 4441, 4307, 4170, 4031, 3889, 3745, 3599, 3450, 3300, 3147, 2993, 2837,
+	2679, 2519, 2358, 2196, 2032, 1867, 1701, 1534, 1366, 1197, 1027, 857, 686, 515, 343, 172,
+	0, -172, -343, -515, -686, -857, -1027, -1197, -1366, -1534, -1701, -1867, -2032, -2196, -2358, -2519,
+	-2679, -2837, -2993, -3147, -3300, -3450, -3599, -3745, -3889, -4031, -4170, -4307, -4441, -4572, -4701, -4827,
+	-4950, -5070, -5187, -5300, -5411, -5518, -5622, -5723, -5820, -5914, -6004, -6091, -6173, -6253, -6328, -6399,
+	-6467, -6531, -6591, -6647, -6699, -6746, -6790, -6830, -6865, -6897, -6924, -6947, -6966, -6981, -6992, -6998,
+	-7000, -6998, -6992, -6981, -6966, -6947, -6924, -6897, -6865, -6830, -6790, -6746, -6699, -6647, -6591, -6531,
+	-6467, -6399, -6328, -6253, -6173, -6091, -6004, -5914, -5820, -5723, -5622, -5518, -5411, -5300, -5187, -5070,
+	-4950, -4827, -4701, -4572, -4441, -4307, -4170, -4031, -3889, -3745, -3599, -3450, -3300, -3147, -2993, -2837,
+	-2679, -2519, -2358, -2196, -2032, -1867, -1701, -1534, -1366, -1197, -1027, -857, -686, -515, -343, -172,
+	// frame 1
+	0, 3984, 3178, 3818, 3538, 3937, 3796, 4103, 4026, 4282, 4242, 4467, 4449, 4652, 4650, 4836,
+	4845, 5017, 5033, 5194, 5215, 5366, 5390, 5532, 5559, 5692, 5720, 5845, 5873, 5991, 6018, 6128,
+	6154, 6257, 6281, 6377, 6399, 6488, 6507, 6589, 6605, 6679, 6692, 6759, 6768, 6828, 6833, 6886,
+	6886, 6932, 6928, 6967, 6958, 6989, 6975, 7000, 6981, 6998, 6974, 6984, 6954, 6957, 6922, 6918,
+	6877, 6866, 6820, 6802, 6750, 6725, 6668, 6635, 6572, 6533, 6465, 6419, 6345, 6293, 6213, 6154,
+	6070, 6004, 5914, 5843, 5748, 5670, 5570, 5486, 5381, 5291, 5182, 5086, 4972, 4871, 4753, 4647,
+	4525, 4413, 4287, 4171, 4041, 3921, 3787, 3663, 3526, 3397, 3257, 3125, 2982, 2846, 2701, 2562,
+	2415, 2273, 2124, 1979, 1828, 1681, 1529, 1380, 1227, 1077, 923, 770, 616, 463, 308, 154,
+	0, -154, -308, -463, -616, -770, -923, -1077, -1227, -1380, -1529, -1681, -1828, -1979, -2124, -2273,
+	-2415, -2562, -2701, -2846, -2982, -3125, -3257, -3397, -3526, -3663, -3787, -3921, -4041, -4171, -4287, -4413,
+	-4525, -4647, -4753, -4871, -4972, -5086, -5182, -5291, -5381, -5486, -5570, -5670, -5748, -5843, -5914, -6004,
+	-6070, -6154, -6213, -6293, -6345, -6419, -6465, -6533, -6572, -6635, -6668, -6725, -6750, -6802, -6820, -6866,
+	-6877, -6918, -6922, -6957, -6954, -6984, -6974, -6998, -6981, -7000, -6975, -6989, -6958, -6967, -6928, -6932,
+	-6886, -6886, -6833, -6828, -6768, -6759, -6692, -6679, -6605, -6589, -6507, -6488, -6399, -6377, -6281, -6257,
+	-6154, -6128, -6018, -5991, -5873, -5845, -5720, -5692, -5559, -5532, -5390, -5366, -5215, -5194, -5033, -5017,
+	-4845, -4836, -4650, -4652, -4449, -4467, -4242, -4282, -4026, -4103, -3796, -3937, -3538, -3818, -3178, -3984,
+	// frame 2
+	0, 7000, 5389, 6378, 5714, 6270, 5857, 6247, 5950, 6253, 6023, 6271, 6084, 6294, 6138, 6320,
+	6185, 6346, 6228, 6372, 6266, 6395, 6300, 6417, 6329, 6435, 6354, 6451, 6375, 6462, 6390, 6470,
+	6401, 6473, 6406, 6471, 6406, 6465, 6401, 6453, 6390, 6436, 6374, 6413, 6351, 6385, 6322, 6351,
+	6287, 6310, 6246, 6263, 6198, 6210, 6143, 6150, 6082, 6084, 6014, 6011, 5940, 5931, 5858, 5845,
+	5770, 5752, 5675, 5652, 5573, 5545, 5464, 5432, 5348, 5311, 5226, 5185, 5097, 5051, 4962, 4912,
+	4820, 4766, 4672, 4613, 4517, 4455, 4357, 4291, 4191, 4121, 4019, 3945, 3842, 3764, 3659, 3578,
+	3471, 3387, 3279, 3192, 3082, 2992, 2880, 2787, 2675, 2579, 2466, 2367, 2253, 2152, 2037, 1934,
+	1818, 1713, 1597, 1490, 1373, 1264, 1147, 1037, 920, 808, 691, 578, 461, 347, 231, 116,
+	0, -116, -231, -347, -461, -578, -691, -808, -920, -1037, -1147, -1264, -1373, -1490, -1597, -1713,
+	-1818, -1934, -2037, -2152, -2253, -2367, -2466, -2579, -2675, -2787, -2880, -2992, -3082, -3192, -3279, -3387,
+	-3471, -3578, -3659, -3764, -3842, -3945, -4019, -4121, -4191, -4291, -4357, -4455, -4517, -4613, -4672, -4766,
+	-4820, -4912, -4962, -5051, -5097, -5185, -5226, -5311, -5348, -5432, -5464, -5545, -5573, -5652, -5675, -5752,
+	-5770, -5845, -5858, -5931, -5940, -6011, -6014, -6084, -6082, -6150, -6143, -6210, -6198, -6263, -6246, -6310,
+	-6287, -6351, -6322, -6385, -6351, -6413, -6374, -6436, -6390, -6453, -6401, -6465, -6406, -6471, -6406, -6473,
+	-6401, -6470, -6390, -6462, -6375, -6451, -6354, -6435, -6329, -6417, -6300, -6395, -6266, -6372, -6228, -6346,
+	-6185, -6320, -6138, -6294, -6084, -6271, -6023, -6253, -5950, -6247, -5857, -6270, -5714, -6378, -5389, -7000,
+	// frame 3
+	0, 7000, 5322, 6265, 5541, 6048, 5577, 5917, 5564, 5816, 5532, 5729, 5488, 5649, 5439, 5572,
+	5386, 5498, 5330, 5425, 5271, 5353, 5210, 5282, 5148, 5210, 5084, 5138, 5019, 5066, 4952, 4993,
+	4884, 4919, 4815, 4845, 4744, 4769, 4672, 4693, 4598, 4615, 4523, 4536, 4447, 4456, 4369, 4375,
+	4290, 4293, 4209, 4209, 4126, 4124, 4043, 4037, 3957, 3949, 3870, 3860, 3782, 3769, 3691, 3676,
+	3600, 3582, 3507, 3487, 3412, 3390, 3315, 3292, 3218, 3192, 3118, 3090, 3017, 2988, 2915, 2884,
+	2811, 2778, 2706, 2671, 2599, 2563, 2491, 2453, 2382, 2342, 2271, 2230, 2159, 2117, 2046, 2002,
+	1932, 1887, 1817, 1770, 1701, 1652, 1583, 1534, 1465, 1414, 1346, 1294, 1226, 1173, 1106, 1052,
+	985, 929, 863, 807, 741, 683, 618, 560, 495, 436, 371, 311, 248, 187, 124, 62,
+	0, -62, -124, -187, -248, -311, -371, -436, -495, -560, -618, -683, -741, -807, -863, -929,
+	-985, -1052, -1106, -1173, -1226, -1294, -1346, -1414, -1465, -1534, -1583, -1652, -1701, -1770, -1817, -1887,
+	-1932, -2002, -2046, -2117, -2159, -2230, -2271, -2342, -2382, -2453, -2491, -2563, -2599, -2671, -2706, -2778,
+	-2811, -2884, -2915, -2988, -3017, -3090, -3118, -3192, -3218, -3292, -3315, -3390, -3412, -3487, -3507, -3582,
+	-3600, -3676, -3691, -3769, -3782, -3860, -3870, -3949, -3957, -4037, -4043, -4124, -4126, -4209, -4209, -4293,
+	-4290, -4375, -4369, -4456, -4447, -4536, -4523, -4615, -4598, -4693, -4672, -4769, -4744, -4845, -4815, -4919,
+	-4884, -4993, -4952, -5066, -5019, -5138, -5084, -5210, -5148, -5282, -5210, -5353, -5271, -5425, -5330, -5498,
+	-5386, -5572, -5439, -5649, -5488, -5729, -5532, -5816, -5564, -5917, -5577, -6048, -5541, -6265, -5322, -7000,
+	// frame 4
+	0, 7000, 5307, 6240, 5503, 5999, 5515, 5844, 5479, 5720, 5423, 5609, 5357, 5506, 5285, 5408,
+	5210, 5312, 5132, 5218, 5053, 5126, 4972, 5035, 4891, 4944, 4808, 4854, 4726, 4765, 4643, 4676,
+	4559, 4587, 4475, 4499, 4391, 4411, 4307, 4323, 4222, 4235, 4138, 4148, 4053, 4060, 3968, 3973,
+	3883, 3885, 3798, 3798, 3713, 3711, 3628, 3624, 3542, 3537, 3457, 3450, 3372, 3363, 3286, 3276,
+	3201, 3189, 3115, 3103, 3030, 3016, 2944, 2929, 2858, 2842, 2773, 2756, 2687, 2669, 2602, 2582,
+	2516, 2496, 2430, 2409, 2344, 2323, 2259, 2236, 2173, 2150, 2087, 2063, 2001, 1977, 1915, 1890,
+	1829, 1804, 1743, 1717, 1657, 1631, 1571, 1545, 1485, 1459, 1399, 1372, 1313, 1286, 1227, 1200,
+	1140, 1115, 1054, 1029, 967, 944, 879, 859, 791, 776, 702, 694, 608, 620, 501, 585,
+	0, -585, -501, -620, -608, -694, -702, -776, -791, -859, -879, -944, -967, -1029, -1054, -1115,
+	-1140, -1200, -1227, -1286, -1313, -1372, -1399, -1459, -1485, -1545, -1571, -1631, -1657, -1717, -1743, -1804,
+	-1829, -1890, -1915, -1977, -2001, -2063, -2087, -2150, -2173, -2236, -2259, -2323, -2344, -2409, -2430, -2496,
+	-2516, -2582, -2602, -2669, -2687, -2756, -2773, -2842, -2858, -2929, -2944, -3016, -3030, -3103, -3115, -3189,
+	-3201, -3276, -3286, -3363, -3372, -3450, -3457, -3537, -3542, -3624, -3628, -3711, -3713, -3798, -3798, -3885,
+	-3883, -3973, -3968, -4060, -4053, -4148, -4138, -4235, -4222, -4323, -4307, -4411, -4391, -4499, -4475, -4587,
+	-4559, -4676, -4643, -4765, -4726, -4854, -4808, -4944, -4891, -5035, -4972, -5126, -5053, -5218, -5132, -5312,
+	-5210, -5408, -5285, -5506, -5357, -5609, -5423, -5720, -5479, -5844, -5515, -5999, -5503, -6240, -5307, -7000,
+	// frame 5
+	0, 7000, 5319, 6259, 5532, 6036, 5562, 5901, 5544, 5795, 5507, 5703, 5459, 5618, 5405, 5538,
+	5348, 5461, 5289, 5385, 5228, 5312, 5166, 5239, 5102, 5167, 5039, 5095, 4974, 5024, 4909, 4954,
+	4844, 4884, 4778, 4814, 4712, 4744, 4646, 4675, 4580, 4605, 4514, 4536, 4447, 4467, 4381, 4398,
+	4314, 4329, 4247, 4261, 4180, 4192, 4113, 4123, 4046, 4055, 3979, 3986, 3912, 3918, 3845, 3850,
+	3778, 3781, 3710, 3713, 3643, 3645, 3576, 3577, 3508, 3508, 3441, 3440, 3373, 3372, 3306, 3304,
+	3238, 3236, 3171, 3168, 3103, 3100, 3035, 3032, 2968, 2965, 2900, 2897, 2832, 2829, 2764, 2762,
+	2696, 2694, 2628, 2627, 2560, 2559, 2491, 2492, 2423, 2425, 2354, 2358, 2285, 2292, 2216, 2226,
+	2146, 2160, 2076, 2095, 2004, 2032, 1932, 1970, 1856, 1912, 1775, 1863, 1681, 1837, 1536, 1952,
+	0, -1952, -1536, -1837, -1681, -1863, -1775, -1912, -1856, -1970, -1932, -2032, -2004, -2095, -2076, -2160,
+	-2146, -2226, -2216, -2292, -2285, -2358, -2354, -2425, -2423, -2492, -2491, -2559, -2560, -2627, -2628, -2694,
+	-2696, -2762, -2764, -2829, -2832, -2897, -2900, -2965, -2968, -3032, -3035, -3100, -3103, -3168, -3171, -3236,
+	-3238, -3304, -3306, -3372, -3373, -3440, -3441, -3508, -3508, -3577, -3576, -3645, -3643, -3713, -3710, -3781,
+	-3778, -3850, -3845, -3918, -3912, -3986, -3979, -4055, -4046, -4123, -4113, -4192, -4180, -4261, -4247, -4329,
+	-4314, -4398, -4381, -4467, -4447, -4536, -4514, -4605, -4580, -4675, -4646, -4744, -4712, -4814, -4778, -4884,
+	-4844, -4954, -4909, -5024, -4974, -5095, -5039, -5167, -5102, -5239, -5166, -5312, -5228, -5385, -5289, -5461,
+	-5348, -5538, -5405, -5618, -5459, -5703, -5507, -5795, -5544, -5901, -5562, -6036, -5532, -6259, -5319, -7000,
+	// frame 6
+	0, 7000, 5335, 6287, 5574, 6091, 5631, 5982, 5639, 5903, 5627, 5837, 5606, 5779, 5579, 5726,
+	5548, 5675, 5515, 5626, 5480, 5579, 5444, 5533, 5407, 5487, 5370, 5442, 5332, 5398, 5293, 5354,
+	5254, 5311, 5215, 5267, 5175, 5224, 5136, 5181, 5096, 5139, 5056, 5096, 5015, 5053, 4975, 5011,
+	4935, 4969, 4894, 4927, 4854, 4885, 4813, 4843, 4772, 4801, 4731, 4759, 4690, 4717, 4650, 4675,
+	4609, 4634, 4567, 4592, 4526, 4551, 4485, 4509, 4444, 4468, 4403, 4426, 4361, 4385, 4320, 4344,
+	4279, 4302, 4237, 4261, 4195, 4220, 4154, 4179, 4112, 4138, 4070, 4097, 4028, 4057, 3986, 4016,
+	3944, 3976, 3902, 3935, 3859, 3896, 3816, 3856, 3773, 3816, 3729, 3778, 3685, 3739, 3640, 3702,
+	3595, 3665, 3548, 3630, 3499, 3598, 3447, 3570, 3389, 3549, 3320, 3545, 3225, 3590, 3028, 3921,
+	0, -3921, -3028, -3590, -3225, -3545, -3320, -3549, -3389, -3570, -3447, -3598, -3499, -3630, -3548, -3665,
+	-3595, -3702, -3640, -3739, -3685, -3778, -3729, -3816, -3773, -3856, -3816, -3896, -3859, -3935, -3902, -3976,
+	-3944, -4016, -3986, -4057, -4028, -4097, -4070, -4138, -4112, -4179, -4154, -4220, -4195, -4261, -4237, -4302,
+	-4279, -4344, -4320, -4385, -4361, -4426, -4403, -4468, -4444, -4509, -4485, -4551, -4526, -4592, -4567, -4634,
+	-4609, -4675, -4650, -4717, -4690, -4759, -4731, -4801, -4772, -4843, -4813, -4885, -4854, -4927, -4894, -4969,
+	-4935, -5011, -4975, -5053, -5015, -5096, -5056, -5139, -5096, -5181, -5136, -5224, -5175, -5267, -5215, -5311,
+	-5254, -5354, -5293, -5398, -5332, -5442, -5370, -5487, -5407, -5533, -5444, -5579, -5480, -5626, -5515, -5675,
+	-5548, -5726, -5579, -5779, -5606, -5837, -5627, -5903, -5639, -5982, -5631, -6091, -5574, -6287, -5335, -7000,
+	// frame 7
+	0, 7000, 5360, 6331, 5640, 6177, 5737, 6109, 5786, 6072, 5816, 6048, 5836, 6031, 5850, 6019,
+	5860, 6010, 5868, 6003, 5875, 5997, 5880, 5992, 5884, 5989, 5888, 5985, 5891, 5982, 5893, 5980,
+	5895, 5978, 5897, 5976, 5899, 5975, 5900, 5973, 5902, 5972, 5903, 5971, 5904, 5970, 5905, 5970,
+	5905, 5969, 5906, 5968, 5906, 5968, 5907, 5967, 5907, 5967, 5907, 5967, 5908, 5967, 5908, 5967,
+	5908, 5967, 5908, 5967, 5908, 5967, 5907, 5967, 5907, 5967, 5907, 5968, 5906, 5968, 5906, 5969,
+	5905, 5970, 5905, 5970, 5904, 5971, 5903, 5972, 5902, 5973, 5900, 5975, 5899, 5976, 5897, 5978,
+	5895, 5980, 5893, 5982, 5891, 5985, 5888, 5989, 5884, 5992, 5880, 5997, 5875, 6003, 5868, 6010,
+	5860, 6019, 5850, 6031, 5836, 6048, 5816, 6072, 5786, 6109, 5737, 6177, 5640, 6331, 5360, 7000,
+	0, -7000, -5360, -6331, -5640, -6177, -5737, -6109, -5786, -6072, -5816, -6048, -5836, -6031, -5850, -6019,
+	-5860, -6010, -5868, -6003, -5875, -5997, -5880, -5992, -5884, -5989, -5888, -5985, -5891, -5982, -5893, -5980,
+	-5895, -5978, -5897, -5976, -5899, -5975, -5900, -5973, -5902, -5972, -5903, -5971, -5904, -5970, -5905, -5970,
+	-5905, -5969, -5906, -5968, -5906, -5968, -5907, -5967, -5907, -5967, -5907, -5967, -5908, -5967, -5908, -5967,
+	-5908, -5967, -5908, -5967, -5908, -5967, -5907, -5967, -5907, -5967, -5907, -5968, -5906, -5968, -5906, -5969,
+	-5905, -5970, -5905, -5970, -5904, -5971, -5903, -5972, -5902, -5973, -5900, -5975, -5899, -5976, -5897, -5978,
+	-5895, -5980, -5893, -5982, -5891, -5985, -5888, -5989, -5884, -5992, -5880, -5997, -5875, -6003, -5868, -6010,
+	-5860, -6019, -5850, -6031, -5836, -6048, -5816, -6072, -5786, -6109, -5737, -6177, -5640, -6331, -5360, -7000,
+};
+
+const Wavetable_t g_wt_default = { .data = g_wt_default_data, .num_frames = 8 };
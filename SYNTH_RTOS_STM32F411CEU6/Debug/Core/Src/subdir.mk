@@ -9,51 +9,108 @@ C_SRCS += \
 ../Core/Src/ILI9341_STM32_Driver.c \
 ../Core/Src/biquad.c \
 ../Core/Src/btn.c \
+../Core/Src/fm.c \
 ../Core/Src/freertos.c \
+../Core/Src/fx_arena.c \
+../Core/Src/fx_chain.c \
+../Core/Src/fx_chorus.c \
+../Core/Src/fx_comp.c \
+../Core/Src/fx_delay.c \
+../Core/Src/fx_drive.c \
+../Core/Src/fx_reverb.c \
+../Core/Src/lcd_damage.c \
+../Core/Src/lcd_draw.c \
 ../Core/Src/main.c \
+../Core/Src/mod.c \
+../Core/Src/noise.c \
+../Core/Src/pan.c \
+../Core/Src/perf.c \
 ../Core/Src/rotary.c \
+../Core/Src/scope.c \
 ../Core/Src/sound_engine.c \
+../Core/Src/spectrum.c \
 ../Core/Src/stm32f4xx_hal_msp.c \
 ../Core/Src/stm32f4xx_hal_timebase_tim.c \
 ../Core/Src/stm32f4xx_it.c \
 ../Core/Src/syscalls.c \
 ../Core/Src/sysmem.c \
 ../Core/Src/system_stm32f4xx.c \
-../Core/Src/ui.c 
+../Core/Src/tuning.c \
+../Core/Src/ui.c \
+../Core/Src/wavetable.c \
+../Core/Src/wavetable_data.c 
 
 OBJS += \
 ./Core/Src/ILI9341_GFX.o \
 ./Core/Src/ILI9341_STM32_Driver.o \
 ./Core/Src/biquad.o \
 ./Core/Src/btn.o \
+./Core/Src/fm.o \
 ./Core/Src/freertos.o \
+./Core/Src/fx_arena.o \
+./Core/Src/fx_chain.o \
+./Core/Src/fx_chorus.o \
+./Core/Src/fx_comp.o \
+./Core/Src/fx_delay.o \
+./Core/Src/fx_drive.o \
+./Core/Src/fx_reverb.o \
+./Core/Src/lcd_damage.o \
+./Core/Src/lcd_draw.o \
 ./Core/Src/main.o \
+./Core/Src/mod.o \
+./Core/Src/noise.o \
+./Core/Src/pan.o \
+./Core/Src/perf.o \
 ./Core/Src/rotary.o \
+./Core/Src/scope.o \
 ./Core/Src/sound_engine.o \
+./Core/Src/spectrum.o \
 ./Core/Src/stm32f4xx_hal_msp.o \
 ./Core/Src/stm32f4xx_hal_timebase_tim.o \
 ./Core/Src/stm32f4xx_it.o \
 ./Core/Src/syscalls.o \
 ./Core/Src/sysmem.o \
 ./Core/Src/system_stm32f4xx.o \
-./Core/Src/ui.o 
+./Core/Src/tuning.o \
+./Core/Src/ui.o \
+./Core/Src/wavetable.o \
+./Core/Src/wavetable_data.o 
 
 C_DEPS += \
 ./Core/Src/ILI9341_GFX.d \
 ./Core/Src/ILI9341_STM32_Driver.d \
 ./Core/Src/biquad.d \
 ./Core/Src/btn.d \
+./Core/Src/fm.d \
 ./Core/Src/freertos.d \
+./Core/Src/fx_arena.d \
+./Core/Src/fx_chain.d \
+./Core/Src/fx_chorus.d \
+./Core/Src/fx_comp.d \
+./Core/Src/fx_delay.d \
+./Core/Src/fx_drive.d \
+./Core/Src/fx_reverb.d \
+./Core/Src/lcd_damage.d \
+./Core/Src/lcd_draw.d \
 ./Core/Src/main.d \
+./Core/Src/mod.d \
+./Core/Src/noise.d \
+./Core/Src/pan.d \
+./Core/Src/perf.d \
 ./Core/Src/rotary.d \
+./Core/Src/scope.d \
 ./Core/Src/sound_engine.d \
+./Core/Src/spectrum.d \
 ./Core/Src/stm32f4xx_hal_msp.d \
 ./Core/Src/stm32f4xx_hal_timebase_tim.d \
 ./Core/Src/stm32f4xx_it.d \
 ./Core/Src/syscalls.d \
 ./Core/Src/sysmem.d \
 ./Core/Src/system_stm32f4xx.d \
-./Core/Src/ui.d 
+./Core/Src/tuning.d \
+./Core/Src/ui.d \
+./Core/Src/wavetable.d \
+./Core/Src/wavetable_data.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -63,7 +120,7 @@ Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/ILI9341_GFX.cyclo ./Core/Src/ILI9341_GFX.d ./Core/Src/ILI9341_GFX.o ./Core/Src/ILI9341_GFX.su ./Core/Src/ILI9341_STM32_Driver.cyclo ./Core/Src/ILI9341_STM32_Driver.d ./Core/Src/ILI9341_STM32_Driver.o ./Core/Src/ILI9341_STM32_Driver.su ./Core/Src/biquad.cyclo ./Core/Src/biquad.d ./Core/Src/biquad.o ./Core/Src/biquad.su ./Core/Src/btn.cyclo ./Core/Src/btn.d ./Core/Src/btn.o ./Core/Src/btn.su ./Core/Src/freertos.cyclo ./Core/Src/freertos.d ./Core/Src/freertos.o ./Core/Src/freertos.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/rotary.cyclo ./Core/Src/rotary.d ./Core/Src/rotary.o ./Core/Src/rotary.su ./Core/Src/sound_engine.cyclo ./Core/Src/sound_engine.d ./Core/Src/sound_engine.o ./Core/Src/sound_engine.su ./Core/Src/stm32f4xx_hal_msp.cyclo ./Core/Src/stm32f4xx_hal_msp.d ./Core/Src/stm32f4xx_hal_msp.o ./Core/Src/stm32f4xx_hal_msp.su ./Core/Src/stm32f4xx_hal_timebase_tim.cyclo ./Core/Src/stm32f4xx_hal_timebase_tim.d ./Core/Src/stm32f4xx_hal_timebase_tim.o ./Core/Src/stm32f4xx_hal_timebase_tim.su ./Core/Src/stm32f4xx_it.cyclo ./Core/Src/stm32f4xx_it.d ./Core/Src/stm32f4xx_it.o ./Core/Src/stm32f4xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f4xx.cyclo ./Core/Src/system_stm32f4xx.d ./Core/Src/system_stm32f4xx.o ./Core/Src/system_stm32f4xx.su ./Core/Src/ui.cyclo ./Core/Src/ui.d ./Core/Src/ui.o ./Core/Src/ui.su
+	-$(RM) ./Core/Src/ILI9341_GFX.cyclo ./Core/Src/ILI9341_GFX.d ./Core/Src/ILI9341_GFX.o ./Core/Src/ILI9341_GFX.su ./Core/Src/ILI9341_STM32_Driver.cyclo ./Core/Src/ILI9341_STM32_Driver.d ./Core/Src/ILI9341_STM32_Driver.o ./Core/Src/ILI9341_STM32_Driver.su ./Core/Src/biquad.cyclo ./Core/Src/biquad.d ./Core/Src/biquad.o ./Core/Src/biquad.su ./Core/Src/btn.cyclo ./Core/Src/btn.d ./Core/Src/btn.o ./Core/Src/btn.su ./Core/Src/fm.cyclo ./Core/Src/fm.d ./Core/Src/fm.o ./Core/Src/fm.su ./Core/Src/freertos.cyclo ./Core/Src/freertos.d ./Core/Src/freertos.o ./Core/Src/freertos.su ./Core/Src/fx_arena.cyclo ./Core/Src/fx_arena.d ./Core/Src/fx_arena.o ./Core/Src/fx_arena.su ./Core/Src/fx_chain.cyclo ./Core/Src/fx_chain.d ./Core/Src/fx_chain.o ./Core/Src/fx_chain.su ./Core/Src/fx_chorus.cyclo ./Core/Src/fx_chorus.d ./Core/Src/fx_chorus.o ./Core/Src/fx_chorus.su ./Core/Src/fx_comp.cyclo ./Core/Src/fx_comp.d ./Core/Src/fx_comp.o ./Core/Src/fx_comp.su ./Core/Src/fx_delay.cyclo ./Core/Src/fx_delay.d ./Core/Src/fx_delay.o ./Core/Src/fx_delay.su ./Core/Src/fx_drive.cyclo ./Core/Src/fx_drive.d ./Core/Src/fx_drive.o ./Core/Src/fx_drive.su ./Core/Src/fx_reverb.cyclo ./Core/Src/fx_reverb.d ./Core/Src/fx_reverb.o ./Core/Src/fx_reverb.su ./Core/Src/lcd_damage.cyclo ./Core/Src/lcd_damage.d ./Core/Src/lcd_damage.o ./Core/Src/lcd_damage.su ./Core/Src/lcd_draw.cyclo ./Core/Src/lcd_draw.d ./Core/Src/lcd_draw.o ./Core/Src/lcd_draw.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/mod.cyclo ./Core/Src/mod.d ./Core/Src/mod.o ./Core/Src/mod.su ./Core/Src/noise.cyclo ./Core/Src/noise.d ./Core/Src/noise.o ./Core/Src/noise.su ./Core/Src/pan.cyclo ./Core/Src/pan.d ./Core/Src/pan.o ./Core/Src/pan.su ./Core/Src/perf.cyclo ./Core/Src/perf.d ./Core/Src/perf.o ./Core/Src/perf.su ./Core/Src/rotary.cyclo ./Core/Src/rotary.d ./Core/Src/rotary.o ./Core/Src/rotary.su ./Core/Src/scope.cyclo ./Core/Src/scope.d ./Core/Src/scope.o ./Core/Src/scope.su ./Core/Src/sound_engine.cyclo ./Core/Src/sound_engine.d ./Core/Src/sound_engine.o ./Core/Src/sound_engine.su ./Core/Src/spectrum.cyclo ./Core/Src/spectrum.d ./Core/Src/spectrum.o ./Core/Src/spectrum.su ./Core/Src/stm32f4xx_hal_msp.cyclo ./Core/Src/stm32f4xx_hal_msp.d ./Core/Src/stm32f4xx_hal_msp.o ./Core/Src/stm32f4xx_hal_msp.su ./Core/Src/stm32f4xx_hal_timebase_tim.cyclo ./Core/Src/stm32f4xx_hal_timebase_tim.d ./Core/Src/stm32f4xx_hal_timebase_tim.o ./Core/Src/stm32f4xx_hal_timebase_tim.su ./Core/Src/stm32f4xx_it.cyclo ./Core/Src/stm32f4xx_it.d ./Core/Src/stm32f4xx_it.o ./Core/Src/stm32f4xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f4xx.cyclo ./Core/Src/system_stm32f4xx.d ./Core/Src/system_stm32f4xx.o ./Core/Src/system_stm32f4xx.su ./Core/Src/tuning.cyclo ./Core/Src/tuning.d ./Core/Src/tuning.o ./Core/Src/tuning.su ./Core/Src/ui.cyclo ./Core/Src/ui.d ./Core/Src/ui.o ./Core/Src/ui.su ./Core/Src/wavetable.cyclo ./Core/Src/wavetable.d ./Core/Src/wavetable.o ./Core/Src/wavetable.su ./Core/Src/wavetable_data.cyclo ./Core/Src/wavetable_data.d ./Core/Src/wavetable_data.o ./Core/Src/wavetable_data.su
 
 .PHONY: clean-Core-2f-Src
 
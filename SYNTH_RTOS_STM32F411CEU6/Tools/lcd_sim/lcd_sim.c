@@ -0,0 +1,1109 @@
+/*
+ * lcd_sim.c
+ *
+ *  ILI9341 호스트 시뮬레이터: ui.c / lcd_draw.c / 드라이버를 PC에서 그대로 실행
+ *
+ *  빌드:  gcc -O2 -o lcd_sim -ITools/lcd_sim/shim -ICore/Inc Tools/lcd_sim/lcd_sim.c \
+ *             Core/Src/ui.c Core/Src/lcd_draw.c Core/Src/lcd_damage.c Core/Src/scope.c \
+ *             Core/Src/ILI9341_STM32_Driver.c Core/Src/ILI9341_GFX.c -lm
+ *  사용:  ./lcd_sim [-t 초] [-p safe|normal|fast] [-i 스크립트] [-o 결과.png|.ppm]
+ *                   [-d 폴더] [-c 기준.ppm] [-v]
+ *         ./lcd_sim -b     (SPI 프로파일별 픽셀 처리량 벤치마크)
+ *         8비트 프레임 드라이버와 비교하려면 빌드에 -DLCD_SPI_16BIT=0
+ *
+ *  - 실제 드라이버(ILI9341_STM32_Driver.c)를 shim/ 의 HAL/FreeRTOS 대체 헤더로 빌드
+ *    → SPI 바이트 스트림을 ILI9341 모델이 해석해 240x320 RGB565 프레임버퍼에 씀
+ *    (명령 0x2A/0x2B 창, 0x2C 메모리 쓰기, 0x36 의 MV 만 반영 — MX/MY/BGR 은
+ *     패널 장착 방향 보정이라 무시, 이미지 = UI 좌표 그대로)
+ *  - 시간: SPI 전송은 비트 수 / SCK 만큼 진행 (CPU 그리기 시간은 0 으로 봄)
+ *    → 지연/점유율은 버스 기준 하한값
+ *    SCK 와 프레임 크기는 드라이버가 쓴 SPI CR1 (BR, DFF) 에서 읽고,
+ *    HAL 핸들 / DMA 폭과 어긋나면 설정 오류로 셈
+ *  - DMA 는 바이트를 바로 모델에 넣고 완료 시각만 기록 → 그 전에 CS/DC 가 바뀌면
+ *    (드라이버가 spi_wait 없이 핀을 바꿈) 경고로 셈, CS high 에서 보낸 바이트도 마찬가지
+ *  - LCD_Task 만 실제로 실행, 태스크 알림 대기 중에 오디오 블록(Scope_Feed, 23.2 ms)과
+ *    입력 스크립트를 시각 순서대로 실행 (입력 태스크/ISR 이 LCD_Task 를 선점하는 것과 같음)
+ *  - 스펙트럼 분석기는 실행하지 않고 톤 배음으로 만든 스냅샷을 씀 (막대 그리기 경로 확인용)
+ *  - -c: 마지막 프레임을 기준 PPM 과 비교, 다르면 종료 코드 1 (ui.c 회귀 확인)
+ *
+ *  스크립트 (한 줄에 하나, # 은 주석, 시각은 스케줄러 시작 기준 ms):
+ *      <ms> enc <delta>      UI_OnEncoderDelta (입력 태스크)
+ *      <ms> vol <delta>      UI_OnChangeVolume
+ *      <ms> oct <delta>      UI_OnChangeOctave
+ *      <ms> key1 | key2      로터리 버튼 EXTI (ISR 문맥)
+ *      <ms> note <midi>      건반 누름 (g_ui_note + UI_Notify, 톤 시작)
+ *      <ms> off              건반 뗌 (톤 정지)
+ */
+
+#include "main.h"
+#include "ILI9341_STM32_Driver.h"
+#include "ui.h"
+#include "lcd_draw.h"
+#include "scope.h"
+#include "spectrum.h"
+#include "semphr.h"
+#include <math.h>
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define SIM_HCLK          100000000u
+#define SIM_PCLK1         50000000u   // APB1 = HCLK / 2 (SPI2)
+#define SIM_FS            44100
+#define SIM_BLOCK         1024        // 오디오 하프 블록 (스테레오 프레임)
+#define SIM_GRAM_W        240
+#define SIM_GRAM_H        320
+#define SIM_MAX_EVENTS    1024
+#define NS_PER_MS         1000000ull
+
+uint32_t SystemCoreClock = SIM_HCLK;
+GPIO_TypeDef sim_gpio[5];
+// MX_SPI2_Init / HAL_SPI_MspInit 직후 상태 (8비트, /2, DMA 바이트 폭)
+static SPI_TypeDef spi2_regs = { .CR1 = SPI_DATASIZE_8BIT
+		| SPI_BAUDRATEPRESCALER_2 };
+static DMA_Stream_TypeDef dma1_stream4;
+static DMA_HandleTypeDef hdma_spi2_tx = { .Instance = &dma1_stream4 };
+SPI_HandleTypeDef hspi2 = { .Instance = &spi2_regs, .Init = { .DataSize =
+SPI_DATASIZE_8BIT, .BaudRatePrescaler = SPI_BAUDRATEPRESCALER_2 }, .hdmatx =
+		&hdma_spi2_tx };
+
+static const char *const profile_name[LCD_SPI_PROFILE_COUNT] = { "safe",
+		"normal", "fast" };
+
+// ===== 시뮬레이션 시각 / 이벤트 =====
+typedef enum {
+	SCR_ENC = 0, SCR_VOL, SCR_OCT, SCR_KEY1, SCR_KEY2, SCR_NOTE, SCR_OFF
+} Script_Op_t;
+
+typedef struct {
+	uint64_t t;      // 스케줄러 시작 기준 ns
+	Script_Op_t op;
+	int arg;
+} Script_Event_t;
+
+static uint64_t sim_ns;
+static uint64_t sim_t0;           // 스케줄러 시작 시각
+static uint64_t sim_end;
+static uint8_t sim_running;       // 스케줄러 시작 후에만 이벤트 실행
+static uint8_t sim_in_isr;
+static jmp_buf sim_done;
+
+static Script_Event_t script[SIM_MAX_EVENTS];
+static int script_n, script_pos;
+static uint64_t next_audio;
+static uint32_t audio_blocks;
+
+static int verbose;
+
+// ===== ILI9341 모델 =====
+typedef struct {
+	uint8_t cs, dc;               // 현재 핀 상태 (1 = high)
+	uint8_t cmd;                  // 마지막 명령
+	uint8_t nparam;
+	uint8_t param[4];
+	uint8_t mv;                   // MADCTL MV (가로 모드)
+	uint8_t ram;                  // 0x2C 이후 픽셀 스트림 중
+	uint8_t have_hi;
+	uint8_t hi;
+	uint16_t xs, xe, ys, ye;      // 주소 창 (양 끝 포함)
+	uint16_t x, y;
+} Sim_Lcd_t;
+
+typedef struct {
+	uint64_t bytes;               // SPI 바이트 (CS low)
+	uint64_t stray;               // CS high 에서 보낸 바이트 (드라이버 버그)
+	uint64_t races;               // DMA 전송 중 CS/DC 변경 (드라이버 버그, 완료 대기 누락)
+	uint64_t transactions;        // CS 하강 에지
+	uint64_t commands;
+	uint64_t windows;             // 0x2C (메모리 쓰기 시작)
+	uint64_t pixels;              // 화면 안에 쓴 픽셀
+	uint64_t same;                // 이미 같은 색이던 픽셀 (불필요한 전송)
+	uint64_t clipped;             // 화면 밖 픽셀 (창이 화면보다 큼)
+	uint64_t bus_ns;              // 버스 점유 시간
+	uint64_t words16;             // 16비트 프레임으로 보낸 값
+	uint64_t cfg_errors;          // CR1 / HAL 핸들 / DMA 폭 불일치
+	uint32_t frames;              // 내용이 바뀐 LCD_Task 패스
+} Sim_Stats_t;
+
+static Sim_Lcd_t lcd = { .cs = 1, .dc = 1, .xe = SIM_GRAM_W - 1, .ye =
+SIM_GRAM_H - 1 };
+static Sim_Stats_t st;
+static uint16_t fb[SIM_GRAM_W * SIM_GRAM_H];
+static uint8_t fb_dirty;
+static uint64_t bus_free;         // 진행 중인 DMA 가 끝나는 시각
+
+static int fb_w(void) {
+	return lcd.mv ? SIM_GRAM_H : SIM_GRAM_W;
+}
+
+static int fb_h(void) {
+	return lcd.mv ? SIM_GRAM_W : SIM_GRAM_H;
+}
+
+static void lcd_pixel(uint16_t c) {
+	if (lcd.x < fb_w() && lcd.y < fb_h()) {
+		uint16_t *p = &fb[lcd.y * fb_w() + lcd.x];
+		if (*p == c)
+			st.same++;
+		*p = c;
+		st.pixels++;
+		fb_dirty = 1;
+	} else {
+		st.clipped++;
+	}
+
+	// 창 안에서 가로 → 세로 순서로 진행, 끝에 닿으면 처음으로
+	if (++lcd.x > lcd.xe) {
+		lcd.x = lcd.xs;
+		if (++lcd.y > lcd.ye)
+			lcd.y = lcd.ys;
+	}
+}
+
+static void lcd_byte(uint8_t b) {
+	if (lcd.cs) {
+		st.stray++;
+		return;
+	}
+	st.bytes++;
+
+	if (!lcd.dc) {
+		st.commands++;
+		lcd.cmd = b;
+		lcd.nparam = 0;
+		lcd.ram = (b == 0x2C);
+		lcd.have_hi = 0;
+		if (b == 0x2C) {
+			st.windows++;
+			lcd.x = lcd.xs;
+			lcd.y = lcd.ys;
+		} else if (b == 0x01) {
+			lcd.mv = 0; // 소프트웨어 리셋
+		}
+		return;
+	}
+
+	if (lcd.ram) {
+		// RGB565, 상위 바이트 먼저
+		if (!lcd.have_hi) {
+			lcd.hi = b;
+			lcd.have_hi = 1;
+		} else {
+			lcd.have_hi = 0;
+			lcd_pixel((uint16_t) (lcd.hi << 8 | b));
+		}
+		return;
+	}
+
+	if (lcd.nparam < sizeof(lcd.param))
+		lcd.param[lcd.nparam] = b;
+	lcd.nparam++;
+
+	if ((lcd.cmd == 0x2A || lcd.cmd == 0x2B) && lcd.nparam == 4) {
+		uint16_t a = (uint16_t) (lcd.param[0] << 8 | lcd.param[1]);
+		uint16_t e = (uint16_t) (lcd.param[2] << 8 | lcd.param[3]);
+		if (lcd.cmd == 0x2A) {
+			lcd.xs = a;
+			lcd.xe = e;
+		} else {
+			lcd.ys = a;
+			lcd.ye = e;
+		}
+	} else if (lcd.cmd == 0x36 && lcd.nparam == 1) {
+		lcd.mv = (b & 0x20) != 0;
+	}
+}
+
+// ===== 오디오 / 스펙트럼 대체 =====
+static uint8_t tone_on;
+static float tone_hz = 261.63f, tone_phase;
+static int16_t audio_buf[SIM_BLOCK * 2];
+
+static Spectrum_Snapshot_t spec_snap;
+static uint32_t spec_seq;
+static uint8_t spec_enabled;
+
+void Spectrum_Enable(uint8_t on) {
+	spec_enabled = on;
+}
+
+int Spectrum_Read(Spectrum_Snapshot_t *out, uint32_t *seq) {
+	if (spec_seq == *seq)
+		return 0;
+	memcpy(out, &spec_snap, sizeof(*out));
+	*seq = spec_seq;
+	return 1;
+}
+
+// 톱니 배음 (h 번째 = -20 log10(h) dB) 을 밴드에 배치, 스냅샷 규칙은 spectrum.c 와 같음
+static void spec_publish(void) {
+	const float ratio = SPEC_F_MAX / SPEC_F_MIN;
+	const float gain_db = 20.0f * log10f((g_ui_vol + 1) / 101.0f) - 12.0f;
+	float db[SPEC_BANDS];
+
+	for (int b = 0; b < SPEC_BANDS; b++)
+		db[b] = -120.0f;
+	for (int h = 1; tone_on && h * tone_hz < SPEC_F_MAX; h++) {
+		int b = (int) floorf(
+				SPEC_BANDS * logf(h * tone_hz / SPEC_F_MIN) / logf(ratio));
+		float d = gain_db - 20.0f * log10f((float) h);
+		if (b >= 0 && b < SPEC_BANDS && d > db[b])
+			db[b] = d;
+	}
+
+	for (int b = 0; b < SPEC_BANDS; b++) {
+		int lv = (int) ((db[b] + SPEC_DB_RANGE) * (255.0f / SPEC_DB_RANGE));
+		if (lv < 0)
+			lv = 0;
+		if (lv > 255)
+			lv = 255;
+		int prev = spec_snap.level[b];
+		if (lv < prev - SPEC_FALL)
+			lv = prev - SPEC_FALL;
+		spec_snap.level[b] = (uint8_t) lv;
+	}
+	spec_seq++;
+	UI_Notify(UI_EVT_SPECTRUM);
+}
+
+// 오디오 하프 블록 1개 (sound_engine 의 Scope_Feed / Spectrum_Feed 자리)
+static void audio_block(void) {
+	audio_blocks++;
+	const float amp = tone_on ? 80.0f * g_ui_vol : 0.0f;
+	const float inc = tone_hz / SIM_FS;
+
+	for (int i = 0; i < SIM_BLOCK; i++) {
+		int16_t s = (int16_t) (amp * (2.0f * tone_phase - 1.0f));
+		audio_buf[2 * i] = s;
+		audio_buf[2 * i + 1] = s;
+		tone_phase += inc;
+		if (tone_phase >= 1.0f)
+			tone_phase -= 1.0f;
+	}
+	Scope_Feed(audio_buf, SIM_BLOCK);
+
+	// SPEC_AVG 프레임 x 홉 = 2048 샘플 = 블록 2개마다 스냅샷
+	if (spec_enabled && (audio_blocks & 1) == 0)
+		spec_publish();
+}
+
+static void script_run(const Script_Event_t *e) {
+	switch (e->op) {
+	case SCR_ENC:
+		UI_OnEncoderDelta(e->arg);
+		break;
+	case SCR_VOL:
+		UI_OnChangeVolume(e->arg);
+		break;
+	case SCR_OCT:
+		UI_OnChangeOctave(e->arg);
+		break;
+	case SCR_KEY1:
+	case SCR_KEY2:
+		sim_in_isr = 1;
+		HAL_GPIO_EXTI_Callback(
+				(e->op == SCR_KEY1) ? Rotary1_KEY_Pin : Rotary2_KEY_Pin);
+		sim_in_isr = 0;
+		break;
+	case SCR_NOTE:
+		g_ui_note = (uint8_t) e->arg;
+		UI_Notify(UI_EVT_MODEL);
+		tone_hz = 440.0f * powf(2.0f, (e->arg - 69) / 12.0f);
+		tone_on = 1;
+		break;
+	case SCR_OFF:
+		tone_on = 0;
+		break;
+	}
+}
+
+// LCD_Task 의 1초 통계가 갱신되면 (LCD_Task 가 쉬는 시점에 확인)
+static UI_LcdStats_t lcd_stats_seen;
+static uint32_t lat_max_seen;
+
+static void stats_check(void) {
+	UI_LcdStats_t s;
+	memcpy(&s, (const void*) &g_ui_lcd_stats, sizeof(s));
+	s.latency_us_last = 0; // 프레임마다 바뀜, 나머지는 1초마다
+	if (!memcmp(&s, &lcd_stats_seen, sizeof(s)))
+		return;
+	lcd_stats_seen = s;
+	s.latency_us_last = g_ui_lcd_stats.latency_us_last;
+	if (s.latency_us_max > lat_max_seen)
+		lat_max_seen = s.latency_us_max;
+	if (!verbose)
+		return;
+	printf("%6.2f s  wake %3u  frames %2u  load %3u‰  px/s %6u  lat %5u us (max %5u)\n",
+			(double) (sim_ns - sim_t0) / 1e9, (unsigned) s.wakeups,
+			(unsigned) s.frames, (unsigned) s.load_permille, (unsigned) s.px,
+			(unsigned) s.latency_us_last, (unsigned) s.latency_us_max);
+}
+
+// 다음 이벤트 시각
+static uint64_t next_event(void) {
+	uint64_t t = next_audio;
+	if (script_pos < script_n && sim_t0 + script[script_pos].t < t)
+		t = sim_t0 + script[script_pos].t;
+	return t;
+}
+
+// 시각 t 까지 진행, 그 사이 이벤트 실행 (LCD_Task 가 선점당하는 것과 같음)
+static void sim_advance_to(uint64_t t) {
+	while (sim_running && next_event() <= t) {
+		uint64_t te = next_event();
+		if (te > sim_ns)
+			sim_ns = te;
+
+		if (script_pos < script_n && sim_t0 + script[script_pos].t == te) {
+			script_run(&script[script_pos++]);
+		} else {
+			audio_block();
+			next_audio = sim_t0
+					+ (uint64_t) audio_blocks * SIM_BLOCK * 1000000000ull / SIM_FS;
+		}
+	}
+	if (t > sim_ns)
+		sim_ns = t;
+}
+
+// ===== HAL 대체 =====
+// CPU 시간은 0 이지만 읽을 때마다 1 사이클씩 진행 (같은 시각에 두 번 읽어도 순서 유지)
+SIM_DWT_TypeDef* sim_dwt(void) {
+	static SIM_DWT_TypeDef dwt;
+	static uint32_t reads;
+	dwt.CYCCNT = (uint32_t) (sim_ns * (SIM_HCLK / 1000000u) / 1000u) + ++reads;
+	return &dwt;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin,
+		GPIO_PinState PinState) {
+	if (PinState == GPIO_PIN_SET)
+		GPIOx->ODR |= GPIO_Pin;
+	else
+		GPIOx->ODR &= ~(uint32_t) GPIO_Pin;
+
+	// 진행 중인 DMA 가 아직 시프트 중인데 핀이 바뀌면 실제 패널에서는 뒤쪽 바이트가 깨짐
+	if (((GPIOx == LCD_CS_PORT && GPIO_Pin == LCD_CS_PIN)
+			|| (GPIOx == LCD_DC_PORT && GPIO_Pin == LCD_DC_PIN))
+			&& bus_free > sim_ns)
+		st.races++;
+
+	if (GPIOx == LCD_CS_PORT && GPIO_Pin == LCD_CS_PIN) {
+		uint8_t cs = (PinState == GPIO_PIN_SET);
+		if (lcd.cs && !cs)
+			st.transactions++;
+		lcd.cs = cs;
+	} else if (GPIOx == LCD_DC_PORT && GPIO_Pin == LCD_DC_PIN) {
+		lcd.dc = (PinState == GPIO_PIN_SET);
+	}
+}
+
+void HAL_Delay(uint32_t Delay) {
+	sim_advance_to(sim_ns + Delay * NS_PER_MS);
+}
+
+uint32_t HAL_GetTick(void) {
+	return (uint32_t) (sim_ns / NS_PER_MS);
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void) {
+	return SIM_PCLK1;
+}
+
+static uint32_t spi_sck(const SPI_HandleTypeDef *h) {
+	return SIM_PCLK1 >> (((h->Instance->CR1 & SPI_CR1_BR) >> SPI_CR1_BR_Pos) + 1);
+}
+
+// Size 프레임을 모델로 보내고 전송 시간(ns) 반환
+// 프레임 크기는 실제 SPI 처럼 CR1 DFF, HAL 은 Init.DataSize 로 버퍼를 읽으므로 둘이 같아야 함
+static uint64_t spi_shift(SPI_HandleTypeDef *h, const uint8_t *p, uint16_t n,
+		uint8_t dma) {
+	const uint8_t dff = (h->Instance->CR1 & SPI_CR1_DFF) != 0;
+	if (dff != (h->Init.DataSize == SPI_DATASIZE_16BIT))
+		st.cfg_errors++;
+	if (dma && h->hdmatx) {
+		const uint32_t cr = h->hdmatx->Instance->CR;
+		const uint32_t want = dff ?
+				(DMA_PDATAALIGN_HALFWORD | DMA_MDATAALIGN_HALFWORD) : 0;
+		if ((cr & (DMA_SxCR_PSIZE | DMA_SxCR_MSIZE)) != want)
+			st.cfg_errors++;
+	}
+	h->Instance->CR1 |= SPI_CR1_SPE;
+
+	if (dff) {
+		const uint16_t *w = (const uint16_t*) p;
+		for (uint16_t i = 0; i < n; i++) {
+			lcd_byte((uint8_t) (w[i] >> 8)); // MSB 먼저
+			lcd_byte((uint8_t) w[i]);
+		}
+		st.words16 += n;
+	} else {
+		for (uint16_t i = 0; i < n; i++)
+			lcd_byte(p[i]);
+	}
+
+	const uint64_t bits = (uint64_t) n * (dff ? 16u : 8u);
+	const uint64_t ns = bits * 1000000000ull / spi_sck(h);
+	st.bus_ns += ns;
+	return ns;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData,
+		uint16_t Size, uint32_t Timeout) {
+	(void) Timeout;
+	if (bus_free > sim_ns)
+		sim_advance_to(bus_free);
+	uint64_t ns = spi_shift(hspi, pData, Size, 0);
+	sim_advance_to(sim_ns + ns);
+	return HAL_OK;
+}
+
+// 바이트는 바로 모델에 넣고 완료 시각만 기록, 세마포어 Take 가 그 시각까지 진행
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData,
+		uint16_t Size) {
+	uint64_t start = (bus_free > sim_ns) ? bus_free : sim_ns;
+	bus_free = start + spi_shift(hspi, pData, Size, 1);
+
+	sim_in_isr = 1;
+	HAL_SPI_TxCpltCallback(hspi);
+	sim_in_isr = 0;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi) {
+	(void) hspi;
+	bus_free = sim_ns;
+	return HAL_OK;
+}
+
+// ===== FreeRTOS 대체 (LCD_Task 하나 + 이벤트 루프) =====
+struct Sim_Task {
+	TaskFunction_t fn;
+	uint32_t bits;
+	uint8_t notified;
+};
+
+struct Sim_Queue {
+	uint32_t item[16];
+	UBaseType_t len, size, head, count;
+};
+
+static struct Sim_Task lcd_task;
+static struct Sim_Queue lcd_queue;
+
+BaseType_t xPortIsInsideInterrupt(void) {
+	return sim_in_isr;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint16_t stack,
+		void *arg, UBaseType_t prio, TaskHandle_t *handle) {
+	(void) name;
+	(void) stack;
+	(void) arg;
+	(void) prio;
+	if (lcd_task.fn != NULL)
+		return pdFAIL;
+	lcd_task.fn = fn;
+	*handle = &lcd_task;
+	return pdPASS;
+}
+
+BaseType_t xTaskGetSchedulerState(void) {
+	return sim_running ? taskSCHEDULER_RUNNING : taskSCHEDULER_NOT_STARTED;
+}
+
+TickType_t xTaskGetTickCount(void) {
+	return (TickType_t) (sim_ns / NS_PER_MS);
+}
+
+void vTaskDelay(TickType_t ticks) {
+	sim_advance_to((sim_ns / NS_PER_MS + ticks) * NS_PER_MS);
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+	if (action == eSetBits)
+		task->bits |= value;
+	else if (action == eSetValueWithOverwrite)
+		task->bits = value;
+	task->notified = 1;
+	return pdPASS;
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value,
+		eNotifyAction action, BaseType_t *woken) {
+	if (woken)
+		*woken = pdTRUE;
+	return xTaskNotify(task, value, action);
+}
+
+static void frame_done(void);
+
+// LCD_Task 가 쉬는 유일한 지점: 이전 패스에서 바뀐 화면을 프레임으로 기록하고 이벤트 진행
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit,
+		uint32_t *value, TickType_t ticks) {
+	frame_done();
+	stats_check();
+
+	if (!lcd_task.notified)
+		lcd_task.bits &= ~clear_on_entry;
+
+	uint64_t deadline = sim_end;
+	if (ticks != portMAX_DELAY) {
+		uint64_t d = (sim_ns / NS_PER_MS + ticks) * NS_PER_MS;
+		if (d < deadline)
+			deadline = d;
+	}
+
+	while (!lcd_task.notified && sim_ns < sim_end) {
+		uint64_t te = next_event();
+		if (te > deadline) {
+			sim_advance_to(deadline);
+			break;
+		}
+		sim_advance_to(te);
+	}
+	if (sim_ns >= sim_end)
+		longjmp(sim_done, 1);
+
+	if (!lcd_task.notified)
+		return pdFALSE;
+	if (value)
+		*value = lcd_task.bits;
+	lcd_task.bits &= ~clear_on_exit;
+	lcd_task.notified = 0;
+	return pdTRUE;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+	if (length > 16 || item_size != sizeof(uint32_t))
+		return NULL;
+	lcd_queue.len = length;
+	lcd_queue.size = item_size;
+	return &lcd_queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks) {
+	(void) ticks;
+	if (q->count >= q->len)
+		return pdFAIL;
+	memcpy(&q->item[(q->head + q->count) % q->len], item, q->size);
+	q->count++;
+	return pdPASS;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item,
+		BaseType_t *woken) {
+	(void) woken;
+	return xQueueSend(q, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks) {
+	(void) ticks;
+	if (q->count == 0)
+		return pdFAIL;
+	memcpy(item, &q->item[q->head], q->size);
+	q->head = (q->head + 1) % q->len;
+	q->count--;
+	return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buf) {
+	buf->count = 0;
+	return buf;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+	if (s->count == 0) {
+		sim_advance_to(sim_ns + ticks * NS_PER_MS);
+		return pdFALSE;
+	}
+	s->count = 0;
+	if (bus_free > sim_ns)
+		sim_advance_to(bus_free); // DMA 끝날 때까지 (그동안 다른 태스크 실행)
+	return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *woken) {
+	s->count = 1;
+	if (woken)
+		*woken = pdFALSE;
+	return pdTRUE;
+}
+
+void Error_Handler(void) {
+	fprintf(stderr, "Error_Handler\n");
+	exit(2);
+}
+
+// ===== 이미지 출력 =====
+static void fb_rgb(uint8_t *rgb) {
+	const int n = fb_w() * fb_h();
+	for (int i = 0; i < n; i++) {
+		uint16_t c = fb[i];
+		uint8_t r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+		rgb[3 * i] = (uint8_t) (r << 3 | r >> 2);
+		rgb[3 * i + 1] = (uint8_t) (g << 2 | g >> 4);
+		rgb[3 * i + 2] = (uint8_t) (b << 3 | b >> 2);
+	}
+}
+
+static uint32_t crc_table[256];
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *p, size_t n) {
+	if (crc_table[1] == 0) {
+		for (uint32_t i = 0; i < 256; i++) {
+			uint32_t c = i;
+			for (int k = 0; k < 8; k++)
+				c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			crc_table[i] = c;
+		}
+	}
+	crc = ~crc;
+	while (n--)
+		crc = crc_table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+static void put_be32(uint8_t *p, uint32_t v) {
+	p[0] = (uint8_t) (v >> 24);
+	p[1] = (uint8_t) (v >> 16);
+	p[2] = (uint8_t) (v >> 8);
+	p[3] = (uint8_t) v;
+}
+
+static void png_chunk(FILE *fp, const char *type, const uint8_t *data,
+		uint32_t len) {
+	uint8_t hdr[8];
+	put_be32(hdr, len);
+	memcpy(hdr + 4, type, 4);
+	uint32_t crc = crc32_update(0, hdr + 4, 4);
+	crc = crc32_update(crc, data, len);
+	fwrite(hdr, 1, 8, fp);
+	fwrite(data, 1, len, fp);
+	put_be32(hdr, crc);
+	fwrite(hdr, 1, 4, fp);
+}
+
+// PNG: zlib 없이 stored(무압축) deflate 블록 (240x320 → 약 230 KB)
+static int write_png(const char *path, const uint8_t *rgb, int w, int h) {
+	const size_t raw_len = (size_t) h * (1 + 3 * w);
+	const size_t nblk = (raw_len + 65534) / 65535;
+	uint8_t *raw = malloc(raw_len);
+	uint8_t *z = malloc(2 + raw_len + 5 * nblk + 4);
+	FILE *fp = fopen(path, "wb");
+	if (!raw || !z || !fp) {
+		fprintf(stderr, "%s: 쓸 수 없음\n", path);
+		free(raw);
+		free(z);
+		if (fp)
+			fclose(fp);
+		return -1;
+	}
+
+	for (int y = 0; y < h; y++) {
+		raw[y * (1 + 3 * w)] = 0; // 필터 없음
+		memcpy(&raw[y * (1 + 3 * w) + 1], &rgb[y * 3 * w], 3 * (size_t) w);
+	}
+
+	size_t zn = 0;
+	z[zn++] = 0x78;
+	z[zn++] = 0x01;
+	uint32_t s1 = 1, s2 = 0;
+	for (size_t off = 0; off < raw_len;) {
+		uint16_t n = (raw_len - off > 65535) ? 65535 : (uint16_t) (raw_len - off);
+		z[zn++] = (off + n == raw_len);
+		z[zn++] = (uint8_t) n;
+		z[zn++] = (uint8_t) (n >> 8);
+		z[zn++] = (uint8_t) ~n;
+		z[zn++] = (uint8_t) (~n >> 8);
+		memcpy(&z[zn], &raw[off], n);
+		zn += n;
+		for (uint16_t i = 0; i < n; i++) {
+			s1 = (s1 + raw[off + i]) % 65521;
+			s2 = (s2 + s1) % 65521;
+		}
+		off += n;
+	}
+	put_be32(&z[zn], s2 << 16 | s1);
+	zn += 4;
+
+	uint8_t ihdr[13];
+	put_be32(ihdr, (uint32_t) w);
+	put_be32(ihdr + 4, (uint32_t) h);
+	ihdr[8] = 8;  // 비트 깊이
+	ihdr[9] = 2;  // RGB
+	ihdr[10] = ihdr[11] = ihdr[12] = 0;
+
+	fwrite("\x89PNG\r\n\x1a\n", 1, 8, fp);
+	png_chunk(fp, "IHDR", ihdr, sizeof(ihdr));
+	png_chunk(fp, "IDAT", z, (uint32_t) zn);
+	png_chunk(fp, "IEND", NULL, 0);
+	fclose(fp);
+	free(raw);
+	free(z);
+	return 0;
+}
+
+static int write_ppm(const char *path, const uint8_t *rgb, int w, int h) {
+	FILE *fp = fopen(path, "wb");
+	if (!fp) {
+		fprintf(stderr, "%s: 쓸 수 없음\n", path);
+		return -1;
+	}
+	fprintf(fp, "P6\n%d %d\n255\n", w, h);
+	fwrite(rgb, 3, (size_t) w * h, fp);
+	fclose(fp);
+	return 0;
+}
+
+// 확장자로 형식 선택 (.ppm 이 아니면 PNG)
+static int write_image(const char *path) {
+	static uint8_t rgb[SIM_GRAM_W * SIM_GRAM_H * 3];
+	const char *ext = strrchr(path, '.');
+	fb_rgb(rgb);
+	if (ext && !strcmp(ext, ".ppm"))
+		return write_ppm(path, rgb, fb_w(), fb_h());
+	return write_png(path, rgb, fb_w(), fb_h());
+}
+
+// 기준 PPM 과 비교 → 다른 픽셀 수 (형식 오류는 -1)
+static long compare_ppm(const char *path) {
+	static uint8_t rgb[SIM_GRAM_W * SIM_GRAM_H * 3];
+	FILE *fp = fopen(path, "rb");
+	int w, h, maxv;
+	if (!fp || fscanf(fp, "P6 %d %d %d", &w, &h, &maxv) != 3 || maxv != 255
+			|| fgetc(fp) == EOF) {
+		fprintf(stderr, "%s: P6 PPM 아님\n", path);
+		if (fp)
+			fclose(fp);
+		return -1;
+	}
+	if (w != fb_w() || h != fb_h()) {
+		fprintf(stderr, "%s: 크기 다름 (%dx%d, 화면 %dx%d)\n", path, w, h, fb_w(),
+				fb_h());
+		fclose(fp);
+		return -1;
+	}
+
+	uint8_t *ref = malloc((size_t) w * h * 3);
+	size_t got = fread(ref, 1, (size_t) w * h * 3, fp);
+	fclose(fp);
+	if (got != (size_t) w * h * 3) {
+		fprintf(stderr, "%s: 데이터 부족\n", path);
+		free(ref);
+		return -1;
+	}
+
+	fb_rgb(rgb);
+	long diff = 0;
+	for (int i = 0; i < w * h; i++)
+		if (memcmp(&rgb[3 * i], &ref[3 * i], 3))
+			diff++;
+	free(ref);
+	return diff;
+}
+
+static const char *dump_dir;
+
+static void frame_done(void) {
+	if (!fb_dirty)
+		return;
+	fb_dirty = 0;
+	st.frames++;
+
+	if (dump_dir) {
+		char path[512];
+		snprintf(path, sizeof(path), "%s/frame_%05u_%07.1fms.png", dump_dir,
+				(unsigned) st.frames, (double) (sim_ns - sim_t0) / 1e6);
+		write_image(path);
+	}
+}
+
+// ===== 입력 스크립트 =====
+static const char *const default_script[] = {
+	"# 기본 세션: 편집 → 건반 → 스펙트럼 화면 → 복귀",
+	"300 note 60",
+	"600 enc 5", "640 enc 5", "680 enc 5", "720 enc -3",
+	"1000 key1", "1100 enc 10", "1140 enc 10",
+	"1400 key1", "1500 enc -20",
+	"1800 key1", "1900 enc 30",
+	"2200 vol -10", "2230 vol -10", "2260 vol -10", "2290 vol 15",
+	"2600 oct 1", "2700 note 76", "3000 off",
+	"3300 note 45",
+	"3600 key2",
+	"5000 note 81",
+	"6000 off",
+	"6500 key2",
+	"7000 key1", "7100 key1", "7200 enc 7",
+	"7500 note 64",
+	"8000 enc 1", "8010 enc 1", "8020 enc 1", "8030 enc 1", "8040 enc 1",
+	"8050 enc 1", "8060 enc 1", "8070 enc 1", "8080 enc 1", "8090 enc 1",
+	"9000 off",
+};
+
+static int script_add(const char *line, const char *src, int lineno) {
+	char op[16];
+	double ms;
+	int arg = 0;
+
+	while (*line == ' ' || *line == '\t')
+		line++;
+	if (*line == '#' || *line == '\n' || *line == '\r' || *line == '\0')
+		return 0;
+
+	int n = sscanf(line, "%lf %15s %d", &ms, op, &arg);
+	Script_Event_t e = { .t = (uint64_t) (ms * NS_PER_MS), .arg = arg };
+	if (n >= 2 && !strcmp(op, "enc") && n == 3)
+		e.op = SCR_ENC;
+	else if (n >= 2 && !strcmp(op, "vol") && n == 3)
+		e.op = SCR_VOL;
+	else if (n >= 2 && !strcmp(op, "oct") && n == 3)
+		e.op = SCR_OCT;
+	else if (n >= 2 && !strcmp(op, "key1"))
+		e.op = SCR_KEY1;
+	else if (n >= 2 && !strcmp(op, "key2"))
+		e.op = SCR_KEY2;
+	else if (n >= 2 && !strcmp(op, "note") && n == 3)
+		e.op = SCR_NOTE;
+	else if (n >= 2 && !strcmp(op, "off"))
+		e.op = SCR_OFF;
+	else {
+		fprintf(stderr, "%s:%d: 알 수 없는 줄: %s", src, lineno, line);
+		return -1;
+	}
+
+	if (script_n >= SIM_MAX_EVENTS || (script_n && e.t < script[script_n - 1].t)) {
+		fprintf(stderr, "%s:%d: 시각 순서가 아니거나 이벤트가 너무 많음\n", src,
+				lineno);
+		return -1;
+	}
+	script[script_n++] = e;
+	return 0;
+}
+
+static int load_script(const char *path) {
+	if (path == NULL) {
+		for (size_t i = 0; i < sizeof(default_script) / sizeof(default_script[0]);
+				i++)
+			if (script_add(default_script[i], "default", (int) i + 1))
+				return -1;
+		return 0;
+	}
+
+	FILE *fp = fopen(path, "r");
+	char line[256];
+	int lineno = 0;
+	if (!fp) {
+		fprintf(stderr, "%s: 열 수 없음\n", path);
+		return -1;
+	}
+	while (fgets(line, sizeof(line), fp))
+		if (script_add(line, path, ++lineno)) {
+			fclose(fp);
+			return -1;
+		}
+	fclose(fp);
+	return 0;
+}
+
+static int find_profile(const char *name) {
+	for (int p = 0; p < LCD_SPI_PROFILE_COUNT; p++)
+		if (!strcmp(name, profile_name[p]))
+			return p;
+	fprintf(stderr, "%s: 알 수 없는 프로파일 (safe|normal|fast)\n", name);
+	return -1;
+}
+
+// ===== 프로파일 벤치마크 =====
+// 스케줄러 시작 상태(DMA 경로)에서 같은 그리기를 프로파일마다 반복, 버스 시간 기준 처리량
+typedef struct {
+	uint64_t ns, pixels, bytes, transactions;
+} Bench_Result_t;
+
+static Bench_Result_t bench_run(void (*fn)(void)) {
+	const Sim_Stats_t s0 = st;
+	const uint64_t t0 = sim_ns;
+	fn();
+	ILI9341_Flush();
+	if (bus_free > sim_ns)
+		sim_advance_to(bus_free);
+	return (Bench_Result_t) { sim_ns - t0, st.pixels + st.clipped - s0.pixels
+			- s0.clipped, st.bytes - s0.bytes, st.transactions
+			- s0.transactions };
+}
+
+static void bench_fill(void) {
+	for (int i = 0; i < 10; i++)
+		LCD_FillRect(0, 0, SIM_GRAM_W - 1, SIM_GRAM_H - 1, (i & 1) ? BLUE : BLACK);
+}
+
+static void bench_text(void) {
+	for (int i = 0; i < 100; i++)
+		LCD_DrawText("CUTOFF 50", 10, 10 + (i % 20) * 14, WHITE, BLACK, 2);
+}
+
+static void bench_rects(void) {
+	for (int i = 0; i < 1000; i++)
+		LCD_FillRect((i * 37) % 230, (i * 53) % 310, (i * 37) % 230 + 3,
+				(i * 53) % 310 + 3, (uint16_t) (i * 2654435761u >> 16));
+}
+
+static int run_bench(void) {
+	static const struct {
+		const char *name;
+		void (*fn)(void);
+		const char *unit;
+		int per;
+	} cases[] = {
+		{ "fill 240x320 x10", bench_fill, "frame/s", 240 * 320 },
+		{ "text size 2 x100", bench_text, "str/s", 0 },
+		{ "4x4 rects x1000", bench_rects, "rect/s", 16 },
+	};
+
+	sim_running = 1; // DMA 경로 (LCD_Task 는 만들지 않음)
+	printf("%-7s %9s  %-18s %10s %9s %12s %8s\n", "profile", "SCK", "case",
+			"Mpx/s", "px/byte", "rate", "us/xact");
+	for (int p = 0; p < LCD_SPI_PROFILE_COUNT; p++) {
+		ILI9341_SPI_SetProfile((LCD_SPI_Profile_t) p);
+		for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+			Bench_Result_t r = bench_run(cases[c].fn);
+			double sec = r.ns / 1e9;
+			double rate = (cases[c].per ? (double) r.pixels / cases[c].per :
+					100.0) / sec;
+			printf("%-7s %5.2f MHz  %-18s %10.3f %9.3f %8.1f %-7s %6.2f\n",
+					profile_name[p], ILI9341_SPI_Hz() / 1e6, cases[c].name,
+					r.pixels / sec / 1e6, (double) r.pixels / r.bytes, rate,
+					cases[c].unit, r.ns / 1e3 / r.transactions);
+		}
+	}
+	printf("(%s pixel frames, bus time only: CPU drawing time excluded)\n",
+			LCD_SPI_16BIT ? "16-bit" : "8-bit");
+	if (st.stray || st.races || st.cfg_errors) {
+		printf("WARNING   : %llu stray bytes, %llu pin changes during DMA,"
+				" %llu config mismatches\n", (unsigned long long) st.stray,
+				(unsigned long long) st.races, (unsigned long long) st.cfg_errors);
+		return 1;
+	}
+	return 0;
+}
+
+int main(int argc, char **argv) {
+	// setjmp 이후에도 쓰는 값은 static (longjmp 가 레지스터 변수를 되돌리지 않게)
+	static const char *script_path, *out_path, *ref_path;
+	static int profile = LCD_SPI_PROFILE_DEFAULT;
+	double seconds = 10.0;
+	int bench = 0;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-t") && i + 1 < argc)
+			seconds = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-p") && i + 1 < argc)
+			profile = find_profile(argv[++i]);
+		else if (!strcmp(argv[i], "-b"))
+			bench = 1;
+		else if (!strcmp(argv[i], "-i") && i + 1 < argc)
+			script_path = argv[++i];
+		else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+			out_path = argv[++i];
+		else if (!strcmp(argv[i], "-d") && i + 1 < argc)
+			dump_dir = argv[++i];
+		else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+			ref_path = argv[++i];
+		else if (!strcmp(argv[i], "-v"))
+			verbose = 1;
+		else {
+			fprintf(stderr,
+					"usage: %s [-t sec] [-p safe|normal|fast] [-i script]\n"
+							"          [-o out.png|.ppm] [-d frame_dir] [-c ref.ppm] [-v]\n"
+							"       %s -b\n", argv[0], argv[0]);
+			return 1;
+		}
+	}
+	if (seconds <= 0.0 || profile < 0 || load_script(script_path))
+		return 1;
+	if (dump_dir)
+		mkdir(dump_dir, 0777); // 이미 있으면 그대로 사용
+
+	// main.c 순서: 스케줄러 전 LCD 초기화 (폴링 전송) → UI_Init → 스케줄러 시작
+	display_init();
+	const Sim_Stats_t init = st;
+	const uint64_t init_ns = sim_ns;
+	if (bench)
+		return run_bench();
+	ILI9341_SPI_SetProfile((LCD_SPI_Profile_t) profile);
+	UI_Init();
+
+	memset(&st, 0, sizeof(st));
+	st.frames = 0;
+	fb_dirty = 0;
+	const LCD_SPI_Stats_t drv0 = g_lcd_spi_stats;
+
+	sim_t0 = sim_ns;
+	sim_end = sim_t0 + (uint64_t) (seconds * 1e9);
+	next_audio = sim_t0;
+	sim_running = 1;
+
+	if (setjmp(sim_done) == 0)
+		lcd_task.fn(NULL); // 돌아오지 않음 (종료 시각에 longjmp)
+	frame_done();
+
+	const double sec = (double) (sim_ns - sim_t0) / 1e9;
+	printf("init      : %.0f ms, %llu bytes, %llu transactions (polled)\n",
+			(double) init_ns / 1e6, (unsigned long long) init.bytes,
+			(unsigned long long) init.transactions);
+	printf("session   : %.2f s @ SPI %s %.2f MHz, %s pixel frames, %d script events,"
+			" %u audio blocks\n", sec, profile_name[profile],
+			ILI9341_SPI_Hz() / 1e6, LCD_SPI_16BIT ? "16-bit" : "8-bit", script_n,
+			(unsigned) audio_blocks);
+	printf("frames    : %u (%.1f/s)\n", (unsigned) st.frames, st.frames / sec);
+	printf("spi       : %llu bytes, %llu transactions, %llu commands, %llu windows\n",
+			(unsigned long long) st.bytes, (unsigned long long) st.transactions,
+			(unsigned long long) st.commands, (unsigned long long) st.windows);
+	printf("pixels    : %llu written, %llu unchanged (%.1f%%), %llu off-screen\n",
+			(unsigned long long) st.pixels, (unsigned long long) st.same,
+			st.pixels ? 100.0 * st.same / st.pixels : 0.0,
+			(unsigned long long) st.clipped);
+	printf("bus       : %.2f%% busy, %.2f Mpx/s while busy (SCK/16 = %.2f),"
+			" %.1f bytes/frame overhead\n", 100.0 * st.bus_ns / (sec * 1e9),
+			st.bus_ns ? st.pixels * 1e3 / st.bus_ns : 0.0,
+			ILI9341_SPI_Hz() / 16e6,
+			st.frames ?
+					(double) (st.bytes - 2 * (st.pixels + st.clipped)) / st.frames :
+					0.0);
+	printf("driver    : %u dma / %u poll xfers, %u timeouts, %u windows, %u pixels,"
+			" %u reconfigs\n",
+			(unsigned) (g_lcd_spi_stats.dma_xfers - drv0.dma_xfers),
+			(unsigned) (g_lcd_spi_stats.poll_xfers - drv0.poll_xfers),
+			(unsigned) (g_lcd_spi_stats.timeouts - drv0.timeouts),
+			(unsigned) (g_lcd_spi_stats.windows - drv0.windows),
+			(unsigned) (g_lcd_spi_stats.pixels - drv0.pixels),
+			(unsigned) (g_lcd_spi_stats.reconfigs - drv0.reconfigs));
+	printf("lcd_task  : latency max %u us (input → frame sent, g_ui_lcd_stats)\n",
+			(unsigned) lat_max_seen);
+	printf("screen    : %dx%d crc32 %08x\n", fb_w(), fb_h(),
+			(unsigned) crc32_update(0, (const uint8_t*) fb,
+					(size_t) fb_w() * fb_h() * 2));
+	if (st.stray)
+		printf("WARNING   : %llu bytes sent with CS high\n",
+				(unsigned long long) st.stray);
+	if (st.races)
+		printf("WARNING   : %llu CS/DC changes while DMA was still shifting\n",
+				(unsigned long long) st.races);
+	if (st.cfg_errors)
+		printf("WARNING   : %llu transfers with SPI CR1 / HAL / DMA width mismatch\n",
+				(unsigned long long) st.cfg_errors);
+
+	if (out_path && write_image(out_path))
+		return 1;
+	if (ref_path) {
+		long diff = compare_ppm(ref_path);
+		if (diff < 0)
+			return 1;
+		printf("compare   : %ld pixels differ from %s\n", diff, ref_path);
+		if (diff)
+			return 1;
+	}
+	return 0;
+}
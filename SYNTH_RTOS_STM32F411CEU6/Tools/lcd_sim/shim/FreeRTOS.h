@@ -0,0 +1,40 @@
+/*
+ * FreeRTOS.h (lcd_sim 용 대체 헤더)
+ *
+ *  태스크는 LCD_Task 하나만 실제로 실행, 대기 함수가 시뮬레이션 시각을 진행시킴
+ *  (오디오 블록 / 입력 스크립트는 그 사이에 이벤트로 실행, Tools/lcd_sim/lcd_sim.c)
+ */
+
+#ifndef SIM_FREERTOS_H_
+#define SIM_FREERTOS_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t StackType_t;
+
+typedef struct {
+	int dummy;
+} StaticTask_t;
+
+typedef struct {
+	int count;
+} StaticSemaphore_t;
+
+#define pdFALSE              ((BaseType_t) 0)
+#define pdTRUE               ((BaseType_t) 1)
+#define pdPASS               pdTRUE
+#define pdFAIL               pdFALSE
+#define portMAX_DELAY        ((TickType_t) 0xFFFFFFFFu)
+#define pdMS_TO_TICKS(ms)    ((TickType_t) (ms))   // configTICK_RATE_HZ = 1000
+#define tskIDLE_PRIORITY     ((UBaseType_t) 0)
+
+#define portYIELD_FROM_ISR(x)  ((void) (x))
+#define configASSERT(x)        do { if (!(x)) abort(); } while (0)
+
+BaseType_t xPortIsInsideInterrupt(void);
+
+#endif /* SIM_FREERTOS_H_ */
@@ -0,0 +1,18 @@
+/*
+ * semphr.h (lcd_sim 용 대체 헤더)
+ *
+ *  SPI 완료 세마포어만 사용: Take 는 진행 중인 전송이 끝나는 시각까지 시뮬레이션을 진행
+ */
+
+#ifndef SIM_SEMPHR_H_
+#define SIM_SEMPHR_H_
+
+#include "FreeRTOS.h"
+
+typedef StaticSemaphore_t *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buf);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *woken);
+
+#endif /* SIM_SEMPHR_H_ */
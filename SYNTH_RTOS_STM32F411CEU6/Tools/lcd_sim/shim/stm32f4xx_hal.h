@@ -0,0 +1,141 @@
+/*
+ * stm32f4xx_hal.h (lcd_sim 용 대체 헤더)
+ *
+ *  Core/Src 의 LCD 코드가 쓰는 HAL 부분만 선언, 구현은 Tools/lcd_sim/lcd_sim.c
+ *  - GPIO / SPI 호출은 ILI9341 모델로 들어감 (CS/DC 핀 상태, 바이트 스트림)
+ *  - SPI 클럭/프레임 크기는 드라이버가 쓴 CR1 (BR, DFF) 에서 읽음
+ *  - DWT->CYCCNT, HAL_GetTick 은 시뮬레이션 시각 기준
+ */
+
+#ifndef SIM_STM32F4XX_HAL_H_
+#define SIM_STM32F4XX_HAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum {
+	HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT
+} HAL_StatusTypeDef;
+
+typedef enum {
+	GPIO_PIN_RESET = 0, GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct {
+	uint32_t ODR;
+} GPIO_TypeDef;
+
+extern GPIO_TypeDef sim_gpio[5];
+#define GPIOA   (&sim_gpio[0])
+#define GPIOB   (&sim_gpio[1])
+#define GPIOC   (&sim_gpio[2])
+#define GPIOD   (&sim_gpio[3])
+#define GPIOE   (&sim_gpio[4])
+
+#define GPIO_PIN_0    ((uint16_t) 0x0001)
+#define GPIO_PIN_1    ((uint16_t) 0x0002)
+#define GPIO_PIN_2    ((uint16_t) 0x0004)
+#define GPIO_PIN_3    ((uint16_t) 0x0008)
+#define GPIO_PIN_4    ((uint16_t) 0x0010)
+#define GPIO_PIN_5    ((uint16_t) 0x0020)
+#define GPIO_PIN_6    ((uint16_t) 0x0040)
+#define GPIO_PIN_7    ((uint16_t) 0x0080)
+#define GPIO_PIN_8    ((uint16_t) 0x0100)
+#define GPIO_PIN_9    ((uint16_t) 0x0200)
+#define GPIO_PIN_10   ((uint16_t) 0x0400)
+#define GPIO_PIN_11   ((uint16_t) 0x0800)
+#define GPIO_PIN_12   ((uint16_t) 0x1000)
+#define GPIO_PIN_13   ((uint16_t) 0x2000)
+#define GPIO_PIN_14   ((uint16_t) 0x4000)
+#define GPIO_PIN_15   ((uint16_t) 0x8000)
+
+// SPI / DMA: 드라이버가 직접 바꾸는 레지스터 비트만 (프레임 크기, 분주비, DMA 폭)
+typedef struct {
+	uint32_t CR1;
+} SPI_TypeDef;
+
+typedef struct {
+	uint32_t CR;
+} DMA_Stream_TypeDef;
+
+typedef struct {
+	uint32_t PeriphDataAlignment;
+	uint32_t MemDataAlignment;
+} DMA_InitTypeDef;
+
+typedef struct {
+	DMA_Stream_TypeDef *Instance;
+	DMA_InitTypeDef Init;
+} DMA_HandleTypeDef;
+
+typedef struct {
+	uint32_t DataSize;
+	uint32_t BaudRatePrescaler;
+} SPI_InitTypeDef;
+
+typedef struct {
+	SPI_TypeDef *Instance;
+	SPI_InitTypeDef Init;
+	DMA_HandleTypeDef *hdmatx;
+} SPI_HandleTypeDef;
+
+#define SPI_CR1_BR_Pos              3U
+#define SPI_CR1_BR                  (0x7UL << SPI_CR1_BR_Pos)
+#define SPI_CR1_SPE                 (0x1UL << 6)
+#define SPI_CR1_DFF                 (0x1UL << 11)
+
+#define SPI_DATASIZE_8BIT           0x00000000U
+#define SPI_DATASIZE_16BIT          SPI_CR1_DFF
+
+#define SPI_BAUDRATEPRESCALER_2     0x00000000U
+#define SPI_BAUDRATEPRESCALER_4     0x00000008U
+#define SPI_BAUDRATEPRESCALER_8     0x00000010U
+#define SPI_BAUDRATEPRESCALER_16    0x00000018U
+#define SPI_BAUDRATEPRESCALER_32    0x00000020U
+#define SPI_BAUDRATEPRESCALER_64    0x00000028U
+#define SPI_BAUDRATEPRESCALER_128   0x00000030U
+#define SPI_BAUDRATEPRESCALER_256   0x00000038U
+
+#define DMA_SxCR_PSIZE              (0x3UL << 11)
+#define DMA_SxCR_MSIZE              (0x3UL << 13)
+#define DMA_PDATAALIGN_BYTE         0x00000000U
+#define DMA_PDATAALIGN_HALFWORD     (0x1UL << 11)
+#define DMA_MDATAALIGN_BYTE         0x00000000U
+#define DMA_MDATAALIGN_HALFWORD     (0x1UL << 13)
+
+#define MODIFY_REG(REG, CLEARMASK, SETMASK) \
+	((REG) = (((REG) & (~(CLEARMASK))) | (SETMASK)))
+#define __HAL_SPI_DISABLE(h)        ((h)->Instance->CR1 &= ~SPI_CR1_SPE)
+
+typedef struct {
+	int id;
+} TIM_HandleTypeDef;
+
+// DWT 사이클 카운터: 읽을 때마다 시뮬레이션 시각에서 계산
+typedef struct {
+	uint32_t CYCCNT;
+} SIM_DWT_TypeDef;
+
+SIM_DWT_TypeDef* sim_dwt(void);
+#define DWT     (sim_dwt())
+
+#define __DMB()   __sync_synchronize()
+
+extern uint32_t SystemCoreClock;
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin,
+		GPIO_PinState PinState);
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData,
+		uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData,
+		uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi);
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+
+#endif /* SIM_STM32F4XX_HAL_H_ */
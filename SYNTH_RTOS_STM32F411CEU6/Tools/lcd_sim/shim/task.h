@@ -0,0 +1,33 @@
+/*
+ * task.h (lcd_sim 용 대체 헤더)
+ */
+
+#ifndef SIM_TASK_H_
+#define SIM_TASK_H_
+
+#include "FreeRTOS.h"
+
+typedef struct Sim_Task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef enum {
+	eNoAction = 0, eSetBits, eIncrement, eSetValueWithOverwrite
+} eNotifyAction;
+
+#define taskSCHEDULER_SUSPENDED    ((BaseType_t) 0)
+#define taskSCHEDULER_NOT_STARTED  ((BaseType_t) 1)
+#define taskSCHEDULER_RUNNING      ((BaseType_t) 2)
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint16_t stack,
+		void *arg, UBaseType_t prio, TaskHandle_t *handle);
+BaseType_t xTaskGetSchedulerState(void);
+TickType_t xTaskGetTickCount(void);
+void vTaskDelay(TickType_t ticks);
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value,
+		eNotifyAction action, BaseType_t *woken);
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit,
+		uint32_t *value, TickType_t ticks);
+
+#endif /* SIM_TASK_H_ */
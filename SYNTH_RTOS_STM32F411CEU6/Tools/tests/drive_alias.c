@@ -0,0 +1,213 @@
+/*
+ * drive_alias.c
+ *
+ *  fx_drive.c 에일리어싱 스펙트럼 테스트 + 배율별 벤치마크 (PC에서 실행)
+ *
+ *  빌드:  gcc -O2 -o drive_alias -ITools/lcd_sim/shim -ICore/Inc \
+ *             Tools/tests/drive_alias.c Core/Src/fx_drive.c Core/Src/fx_arena.c -lm
+ *  사용:  ./drive_alias       스펙트럼 테스트 (실패가 있으면 종료 코드 1)
+ *         ./drive_alias -b    배율별 입력 샘플당 시간 (호스트 기준)
+ *
+ *  - ARM_MATH_CM4 없이 빌드 → fx_drive.c 의 C 폴리페이즈 경로 (타깃 CMSIS 와 같은 계수)
+ *  - 입력: DFT 빈에 정확히 맞춘 사인 (N 프레임 주기) → 정상 상태에서 모든 성분이 빈 위에 있음
+ *    드라이브 출력의 홀수 배음 중 나이퀴스트 아래 = 정상 배음, 나머지 빈 = 되접힌 성분
+ *  - 에일리어싱 = 되접힌 성분 에너지 / 기본파 에너지 (dB)
+ *    하드 클립(24 dB): 배음이 끝없이 이어지므로 2x 는 1x 보다, 4x 는 2x 보다 일정 이상 낮아야 함
+ *    3차 구간(6 dB, 피크 = 클립 경계): 배음은 3차뿐 → 2x 부터 27 kHz 가 데시메이터에서 걸러져야 함
+ *  - 통과대역: 드라이브 없이 작은 신호(선형 구간)는 배율과 상관없이 레벨이 같아야 함
+ */
+
+#include "fx_drive.h"
+#include "fx_arena.h"
+#include "user_rtos.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define N_FFT          8192
+#define WARMUP_FRAMES  (MOD_SUBBLOCK * 64)
+#define TEST_BIN       1672          // 약 9.0 kHz (3차 배음 27 kHz 부터 1x 에서 되접힘)
+#define HARD_DB        24.0f         // 하드 클립에 가까운 드라이브
+#define CUBIC_DB       6.0f          // 0.5 x 2 = 1.0 → 3차 다항식 구간 끝
+#define ALIAS_STEP_DB  10.0          // 하드 클립: 배율을 올릴 때마다 최소 개선
+#define ALIAS_MAX_CUBIC (-70.0)      // 3차 구간: 2x / 4x 절대 한도 (dB, 기본파 기준)
+#define BENCH_FRAMES   (SAMPLE_RATE * 10)
+
+static float out_l[N_FFT];
+static float re_tab[N_FFT], im_tab[N_FFT];
+static int failures;
+
+static void check(int ok, const char *what) {
+	printf("%-4s %s\n", ok ? "ok" : "FAIL", what);
+	if (!ok)
+		failures++;
+}
+
+static void set_drive(uint8_t os, float drive_db, float level) {
+	g_drive.enabled = 1;
+	g_drive.oversample = os;
+	g_drive.drive_db = drive_db;
+	g_drive.level = level;
+}
+
+// 빈 k 사인을 펌웨어처럼 MOD_SUBBLOCK 단위로 통과시키고 워밍업 뒤 N_FFT 프레임 저장 (L)
+static void run_sine(int bin, float amp) {
+	float l[MOD_SUBBLOCK], r[MOD_SUBBLOCK];
+	const int total = WARMUP_FRAMES + N_FFT;
+
+	for (int f = 0; f < total; f += MOD_SUBBLOCK) {
+		for (int j = 0; j < MOD_SUBBLOCK; j++) {
+			double ph = 2.0 * M_PI * (double) bin * (double) ((f + j) % N_FFT)
+					/ N_FFT;
+			l[j] = r[j] = amp * (float) sin(ph);
+		}
+		FX_Drive_Process(l, r, MOD_SUBBLOCK);
+		if (f >= WARMUP_FRAMES)
+			memcpy(&out_l[f - WARMUP_FRAMES], l, sizeof(l));
+	}
+}
+
+// 빈 k 의 파워 (직사각 창, 주기 신호라 누설 없음)
+static double bin_power(int k) {
+	double re = 0.0, im = 0.0;
+	for (int i = 0; i < N_FFT; i++) {
+		int idx = (int) (((long) k * i) % N_FFT);
+		re += out_l[i] * re_tab[idx];
+		im += out_l[i] * im_tab[idx];
+	}
+	return re * re + im * im;
+}
+
+// 홀수 배음 h*k 를 [0, N/2] 로 접은 빈
+static int fold(long hk) {
+	int b = (int) (hk % N_FFT);
+	return (b > N_FFT / 2) ? N_FFT - b : b;
+}
+
+// 되접힌 성분 / 기본파 (dB): 나이퀴스트 위로 넘어간 홀수 배음이 떨어지는 빈만 합산
+static double alias_db(int bin) {
+	static uint8_t is_alias[N_FFT / 2 + 1];
+	double fund = bin_power(bin), alias = 0.0;
+
+	memset(is_alias, 0, sizeof(is_alias));
+	for (long h = 3; h * bin < (long) N_FFT * 8; h += 2) {
+		if (h * bin < N_FFT / 2)
+			continue;              // 정상 배음
+		is_alias[fold(h * bin)] = 1;
+	}
+	for (long h = 1; h * bin < N_FFT / 2; h += 2)
+		is_alias[h * bin] = 0;     // 정상 배음과 겹치는 빈은 제외
+
+	for (int k = 1; k < N_FFT / 2; k++)
+		if (is_alias[k])
+			alias += bin_power(k);
+	return 10.0 * log10(alias / fund + 1e-30);
+}
+
+static double now_s(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+static void bench(void) {
+	static const uint8_t factors[3] = { 1, 2, 4 };
+	float l[MOD_SUBBLOCK], r[MOD_SUBBLOCK];
+	volatile float sink = 0.0f;
+
+	// 데드라인: 1 프레임 = 22.7 us, 스테레오 드라이브가 그중 몇 %를 쓰는지
+	printf("%-4s %12s %12s %10s\n", "os", "ns/frame", "ns/os-smp", "%deadline");
+	for (int i = 0; i < 3; i++) {
+		uint32_t units = 0;
+		set_drive(factors[i], HARD_DB, 0.5f);
+		double t0 = now_s();
+		for (int f = 0; f < BENCH_FRAMES; f += MOD_SUBBLOCK) {
+			for (int j = 0; j < MOD_SUBBLOCK; j++)
+				l[j] = r[j] = 0.5f * sinf(0.05f * (float) (f + j));
+			units += FX_Drive_Process(l, r, MOD_SUBBLOCK);
+			sink += l[0];
+		}
+		double dt = now_s() - t0;
+		double ns = dt * 1e9 / BENCH_FRAMES;
+		printf("%-4u %12.1f %12.2f %9.2f%%\n", (unsigned) factors[i], ns,
+				dt * 1e9 / (2.0 * units), ns * SAMPLE_RATE / 1e7);
+	}
+	printf("(호스트 기준, 타깃은 [PERF] drive 블록의 cyc/os-smp)\n");
+	(void) sink;
+}
+
+int main(int argc, char **argv) {
+	char what[160];
+	int do_bench = (argc > 1 && !strcmp(argv[1], "-b"));
+
+	if (argc > 1 && !do_bench) {
+		fprintf(stderr, "사용: %s [-b]\n", argv[0]);
+		return 2;
+	}
+
+	FX_Arena_Reset();
+	if (FX_Drive_Init() != 0) {
+		printf("FAIL FX_Drive_Init (아레나 부족)\n");
+		return 1;
+	}
+	if (do_bench) {
+		bench();
+		return 0;
+	}
+
+	for (int i = 0; i < N_FFT; i++) {
+		re_tab[i] = (float) cos(2.0 * M_PI * i / N_FFT);
+		im_tab[i] = (float) -sin(2.0 * M_PI * i / N_FFT);
+	}
+
+	// 1) 에일리어싱: 배율별 되접힌 성분 (하드 클립 / 3차 구간)
+	static const uint8_t factors[3] = { 1, 2, 4 };
+	static const float drives[2] = { HARD_DB, CUBIC_DB };
+	double a[2][3];
+	for (int d = 0; d < 2; d++) {
+		for (int i = 0; i < 3; i++) {
+			set_drive(factors[i], drives[d], 0.5f);
+			run_sine(TEST_BIN, 0.5f);
+			a[d][i] = alias_db(TEST_BIN);
+			printf("     %ux: %.0f Hz, drive %.0f dB → 에일리어싱 %.1f dB\n",
+					(unsigned) factors[i],
+					(double) TEST_BIN * SAMPLE_RATE / N_FFT, (double) drives[d],
+					a[d][i]);
+		}
+	}
+	for (int i = 1; i < 3; i++) {
+		snprintf(what, sizeof(what), "하드 클립: %ux 가 %ux 보다 %.1f dB 낮음 (>= %.0f)",
+				(unsigned) factors[i], (unsigned) factors[i - 1],
+				a[0][i - 1] - a[0][i], ALIAS_STEP_DB);
+		check(a[0][i - 1] - a[0][i] >= ALIAS_STEP_DB, what);
+	}
+	for (int i = 1; i < 3; i++) {
+		snprintf(what, sizeof(what), "3차 구간: %ux 에일리어싱 %.1f dB (<= %.0f, 1x %.1f dB)",
+				(unsigned) factors[i], a[1][i], ALIAS_MAX_CUBIC, a[1][0]);
+		check(a[1][i] <= ALIAS_MAX_CUBIC, what);
+	}
+
+	// 2) 통과대역: 선형 구간(작은 신호, 0 dB)에서 1 kHz / 15 kHz 레벨이 1x 와 같아야 함
+	static const int pass_bins[2] = { 186, 2786 };
+	for (int p = 0; p < 2; p++) {
+		double ref = 0.0;
+		for (int i = 0; i < 3; i++) {
+			set_drive(factors[i], 0.0f, 1.0f);
+			run_sine(pass_bins[p], 0.01f);
+			double pw = bin_power(pass_bins[p]);
+			if (i == 0) {
+				ref = pw;
+				continue;
+			}
+			double db = 10.0 * log10(pw / ref);
+			snprintf(what, sizeof(what), "%ux 통과대역 %.0f Hz: %+.2f dB (±0.5)",
+					(unsigned) factors[i],
+					(double) pass_bins[p] * SAMPLE_RATE / N_FFT, db);
+			check(fabs(db) <= 0.5, what);
+		}
+	}
+
+	printf("%s (%d 실패)\n", failures ? "FAIL" : "PASS", failures);
+	return failures ? 1 : 0;
+}
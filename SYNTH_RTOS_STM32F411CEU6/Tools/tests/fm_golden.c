@@ -0,0 +1,304 @@
+/*
+ * fm_golden.c
+ *
+ *  fm.c 골든 WAV 회귀 테스트 + 호스트 벤치마크
+ *
+ *  빌드:  gcc -O2 -o fm_golden -ITools/lcd_sim/shim -ICore/Inc \
+ *             Tools/tests/fm_golden.c Core/Src/fm.c Core/Src/mod.c Core/Src/tuning.c -lm
+ *  사용:  ./fm_golden [-d 폴더]       골든과 비교 (기본 Tools/tests/golden, 실패 시 종료 코드 1)
+ *         ./fm_golden -w [-d 폴더]    골든 다시 쓰기 (fm.c 음색을 의도적으로 바꿨을 때만)
+ *         ./fm_golden -b              알고리즘별 오퍼레이터-샘플당 시간 (호스트 기준)
+ *
+ *  - 펌웨어와 같은 순서로 렌더링: NoteOn → (FM_Tick + FM_Render MOD_SUBBLOCK) 반복 → NoteOff
+ *    C4, 게이트 GATE_FRAMES 후 릴리즈 REL_FRAMES, 모노 16비트 44.1 kHz WAV
+ *  - 패치: 기본 패치(FM_Init, 2 스택 EP) + 알고리즘 6개 + 피드백 + 피치 램프(step != 0)
+ *  - 비교: 차이 RMS 가 기준 RMS 대비 -60 dB 이하면 통과
+ *  - 오퍼레이터 비율 범위 (FM_SetOperator 가 0 이하 / 상한 초과를 거부하는지)
+ *    (골든은 호스트 float 결과, 컴파일러/FMA 차이로 LUT 인덱스가 가끔 1 바뀌는 정도는 허용)
+ *  - 타깃 사이클은 펌웨어 [PERF] fm 블록 리포트 (~N op @deadline) 로 확인
+ */
+
+#include "fm.h"
+#include "tuning.h"
+#include "user_rtos.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define GATE_FRAMES   6144
+#define REL_FRAMES    2048
+#define TOTAL_FRAMES  (GATE_FRAMES + REL_FRAMES)
+#define MAX_ERR_DB    (-60.0)
+#define BENCH_FRAMES  (SAMPLE_RATE * 20)
+
+// sound_engine.c 가 정의하는 LUT (Init_All_LUTs 와 같은 식으로 채움)
+int16_t sine_lut[LUT_SIZE];
+int16_t saw_lut[LUT_SIZE];
+int16_t square_lut[LUT_SIZE];
+int16_t *current_lut = sine_lut;
+
+typedef struct {
+	const char *name;
+	FM_Algorithm_t alg;
+	uint8_t feedback;
+	int32_t step;        // 서브블록 안 tuning word 램프 (샘플당)
+	uint8_t default_patch;
+} Case_t;
+
+static const Case_t cases[] = {
+	{ "fm_default", FM_ALG_TWO_STACKS, 0, 0, 1 },
+	{ "fm_stack", FM_ALG_STACK, 0, 0, 0 },
+	{ "fm_y", FM_ALG_Y, 0, 0, 0 },
+	{ "fm_two_stacks", FM_ALG_TWO_STACKS, 0, 0, 0 },
+	{ "fm_one_to_three", FM_ALG_ONE_TO_THREE, 0, 0, 0 },
+	{ "fm_two_op", FM_ALG_TWO_OP, 0, 0, 0 },
+	{ "fm_additive", FM_ALG_ADDITIVE, 0, 0, 0 },
+	{ "fm_feedback", FM_ALG_STACK, FM_FEEDBACK_MAX, 0, 0 },
+	{ "fm_ramp", FM_ALG_STACK, 3, 4, 0 },
+};
+#define NUM_CASES  ((int) (sizeof(cases) / sizeof(cases[0])))
+
+static int16_t out_pcm[TOTAL_FRAMES];
+static int16_t ref_pcm[TOTAL_FRAMES];
+
+static void init_luts(void) {
+	int16_t amplitude = LUT_AMPLITUDE;
+
+	for (int i = 0; i < LUT_SIZE; i++) {
+		sine_lut[i] = (int16_t) (amplitude
+				* sinf(2.0f * 3.141592f * (float) i / (float) LUT_SIZE));
+		saw_lut[i] = (int16_t) (-amplitude
+				+ (2.0f * amplitude * i / (float) LUT_SIZE));
+		square_lut[i] = (i < LUT_SIZE / 2) ? amplitude : -amplitude;
+	}
+}
+
+static void load_patch(const Case_t *c) {
+	FM_Init();
+	if (c->default_patch)
+		return;
+
+	// 알고리즘 비교용 공통 패치 (오퍼레이터마다 다른 비율/엔벨로프)
+	FM_SetAlgorithm(c->alg);
+	FM_SetFeedback(c->feedback);
+	FM_SetOperator(0, 1.0f, 1.0f, 5, 400, 0.6f, 80);
+	FM_SetOperator(1, 2.0f, 0.7f, 1, 200, 0.4f, 80);
+	FM_SetOperator(2, 3.0f, 0.5f, 10, 300, 0.5f, 60);
+	FM_SetOperator(3, 0.5f, 0.8f, 2, 150, 0.3f, 40);
+}
+
+// 한 케이스 렌더링 (펌웨어 Voice 렌더러와 같은 서브블록 순서)
+static uint32_t render(const Case_t *c, int16_t *pcm, int frames) {
+	static FM_Voice_t fv;
+	float buf[MOD_SUBBLOCK];
+	uint32_t word = Tuning_Word(NOTE_C4);
+	uint32_t units = 0;
+
+	load_patch(c);
+	FM_NoteOn(&fv);
+
+	for (int f = 0; f < frames; f += MOD_SUBBLOCK) {
+		int n = frames - f;
+		if (n > MOD_SUBBLOCK)
+			n = MOD_SUBBLOCK;
+		if (f == GATE_FRAMES)
+			FM_NoteOff(&fv);
+
+		FM_Tick(&fv);
+		for (int j = 0; j < n; j++)
+			buf[j] = 0.0f;
+		units += FM_Render(&fv, word, c->step, buf, n);
+		word += (uint32_t) (c->step * n);
+
+		if (pcm) {
+			for (int j = 0; j < n; j++) {
+				float s = buf[j];
+				if (s > 32767.0f)
+					s = 32767.0f;
+				if (s < -32768.0f)
+					s = -32768.0f;
+				pcm[f + j] = (int16_t) lrintf(s);
+			}
+		}
+	}
+	return units;
+}
+
+// ===== WAV (모노 16비트 PCM) =====
+static void put_u32(uint8_t *p, uint32_t v) {
+	p[0] = (uint8_t) v;
+	p[1] = (uint8_t) (v >> 8);
+	p[2] = (uint8_t) (v >> 16);
+	p[3] = (uint8_t) (v >> 24);
+}
+
+static int write_wav(const char *path, const int16_t *pcm, int frames) {
+	uint8_t h[44];
+	uint32_t data = (uint32_t) frames * 2u;
+
+	memcpy(h, "RIFF", 4);
+	put_u32(h + 4, 36u + data);
+	memcpy(h + 8, "WAVEfmt ", 8);
+	put_u32(h + 16, 16);
+	put_u32(h + 20, 1u | (1u << 16));              // PCM, 1채널
+	put_u32(h + 24, SAMPLE_RATE);
+	put_u32(h + 28, SAMPLE_RATE * 2u);
+	put_u32(h + 32, 2u | (16u << 16));             // block align 2, 16비트
+	memcpy(h + 36, "data", 4);
+	put_u32(h + 40, data);
+
+	FILE *f = fopen(path, "wb");
+	if (!f)
+		return -1;
+	fwrite(h, 1, sizeof(h), f);
+	for (int i = 0; i < frames; i++) {
+		uint8_t b[2] = { (uint8_t) pcm[i], (uint8_t) ((uint16_t) pcm[i] >> 8) };
+		fwrite(b, 1, 2, f);
+	}
+	return fclose(f);
+}
+
+// data 청크만 찾아서 읽음 (반환: 프레임 수, 실패 -1)
+static int read_wav(const char *path, int16_t *pcm, int max_frames) {
+	uint8_t h[12], ch[8];
+	FILE *f = fopen(path, "rb");
+	if (!f)
+		return -1;
+	if (fread(h, 1, 12, f) != 12 || memcmp(h, "RIFF", 4)
+			|| memcmp(h + 8, "WAVE", 4)) {
+		fclose(f);
+		return -1;
+	}
+	while (fread(ch, 1, 8, f) == 8) {
+		uint32_t len = (uint32_t) ch[4] | ((uint32_t) ch[5] << 8)
+				| ((uint32_t) ch[6] << 16) | ((uint32_t) ch[7] << 24);
+		if (memcmp(ch, "data", 4) != 0) {
+			fseek(f, (long) ((len + 1u) & ~1u), SEEK_CUR);
+			continue;
+		}
+		int n = (int) (len / 2u);
+		if (n > max_frames)
+			n = max_frames;
+		for (int i = 0; i < n; i++) {
+			uint8_t b[2];
+			if (fread(b, 1, 2, f) != 2) {
+				fclose(f);
+				return -1;
+			}
+			pcm[i] = (int16_t) (b[0] | (b[1] << 8));
+		}
+		fclose(f);
+		return n;
+	}
+	fclose(f);
+	return -1;
+}
+
+// ===== 벤치마크 =====
+static double now_s(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+static void bench(void) {
+	// 데드라인: 1024 프레임 블록 = 23.2 ms, 같은 시간 안에 돌릴 수 있는 오퍼레이터 수
+	printf("%-16s %10s %12s %14s\n", "case", "ops/voice", "ns/op-smp",
+			"ops@deadline");
+	for (int i = 0; i < NUM_CASES; i++) {
+		double t0 = now_s();
+		uint32_t units = render(&cases[i], NULL, BENCH_FRAMES);
+		double dt = now_s() - t0;
+		double ns = dt * 1e9 / (double) units;
+		printf("%-16s %10.1f %12.2f %14.0f\n", cases[i].name,
+				(double) units / BENCH_FRAMES, ns,
+				1e9 / SAMPLE_RATE / ns);
+	}
+	printf("(호스트 기준, 타깃은 [PERF] fm 블록의 cyc/op-smp 와 ~N op @deadline)\n");
+}
+
+int main(int argc, char **argv) {
+	const char *dir = "Tools/tests/golden";
+	int write = 0, failures = 0;
+	char path[512];
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-w")) {
+			write = 1;
+		} else if (!strcmp(argv[i], "-d") && i + 1 < argc) {
+			dir = argv[++i];
+		} else if (!strcmp(argv[i], "-b")) {
+			init_luts();
+			Tuning_Init();
+			bench();
+			return 0;
+		} else {
+			fprintf(stderr, "사용: %s [-w] [-d 폴더] | -b\n", argv[0]);
+			return 2;
+		}
+	}
+
+	init_luts();
+	Tuning_Init();
+
+	for (int i = 0; i < NUM_CASES; i++) {
+		const Case_t *c = &cases[i];
+		snprintf(path, sizeof(path), "%s/%s.wav", dir, c->name);
+		render(c, out_pcm, TOTAL_FRAMES);
+
+		if (write) {
+			if (write_wav(path, out_pcm, TOTAL_FRAMES) != 0) {
+				fprintf(stderr, "%s: 쓸 수 없음\n", path);
+				return 2;
+			}
+			printf("wrote %s\n", path);
+			continue;
+		}
+
+		int n = read_wav(path, ref_pcm, TOTAL_FRAMES);
+		if (n != TOTAL_FRAMES) {
+			printf("FAIL %-16s 골든 없음/길이 다름 (%s)\n", c->name, path);
+			failures++;
+			continue;
+		}
+
+		double e2 = 0.0, r2 = 0.0;
+		int max_diff = 0, diff_n = 0;
+		for (int k = 0; k < n; k++) {
+			int d = out_pcm[k] - ref_pcm[k];
+			if (d) {
+				diff_n++;
+				if (abs(d) > max_diff)
+					max_diff = abs(d);
+			}
+			e2 += (double) d * d;
+			r2 += (double) ref_pcm[k] * ref_pcm[k];
+		}
+		double err_db = (e2 > 0.0) ? 10.0 * log10(e2 / (r2 + 1e-9)) : -999.0;
+		int ok = (r2 > 0.0) && err_db <= MAX_ERR_DB;
+		printf("%-4s %-16s diff %5d smp, max %4d LSB, err %7.1f dB\n",
+				ok ? "ok" : "FAIL", c->name, diff_n, max_diff, err_db);
+		if (!ok)
+			failures++;
+	}
+
+	if (!write) {
+		// FM_SetOperator: 0 / 음수 / NaN / 상한 초과 비율은 거부 (패치 그대로)
+		FM_Init();
+		FM_Patch_t before = g_fm_patch;
+		FM_SetOperator(3, 0.0f, 1.0f, 1, 1, 1.0f, 1);
+		FM_SetOperator(3, -2.0f, 1.0f, 1, 1, 1.0f, 1);
+		FM_SetOperator(3, NAN, 1.0f, 1, 1, 1.0f, 1);
+		FM_SetOperator(3, FM_RATIO_MAX * 2.0f, 1.0f, 1, 1, 1.0f, 1);
+		int ok = !memcmp(&before, &g_fm_patch, sizeof(before));
+		printf("%-4s %-16s 비율 <= 0 / NaN / > FM_RATIO_MAX 거부\n",
+				ok ? "ok" : "FAIL", "FM_SetOperator");
+		if (!ok)
+			failures++;
+
+		printf("%s (%d 실패)\n", failures ? "FAIL" : "PASS", failures);
+	}
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,221 @@
+/*
+ * reverb_ir.c
+ *
+ *  fx_reverb.c 임펄스 응답 테스트 (PC에서 실행)
+ *
+ *  빌드:  gcc -O2 -o reverb_ir -ITools/lcd_sim/shim -ICore/Inc [-DREVERB_PRESET=0|1|2] \
+ *             Tools/tests/reverb_ir.c Core/Src/fx_reverb.c Core/Src/fx_arena.c -lm
+ *  사용:  ./reverb_ir [-o ir.wav]     (실패가 있으면 종료 코드 1, -o: 스테레오 IR 저장)
+ *
+ *  - 펌웨어처럼 MOD_SUBBLOCK 단위로 FX_Reverb_Process 호출, 입력은 0번 프레임 임펄스
+ *  - RT60: Schroeder 역적분 에너지 곡선의 -5 ~ -35 dB 기울기 (T30 x 2)
+ *    → g_reverb.decay_s 의 ±20% 안 (damping 0, 1초 / 2초)
+ *  - 안정성: 출력이 유한하고 피크 < 1.0, 6 x RT60 뒤 꼬리 < -60 dB (int16 라인의 잔류 진동 확인)
+ *  - 스테레오: 초기 반사 이후 L/R 상관계수 |r| < 0.5
+ *  - damping: 0.8 일 때 꼬리의 고역 비율(1차 차분 에너지 / 에너지)이 damping 0 보다 낮아야 함
+ */
+
+#include "fx_reverb.h"
+#include "mod.h"
+#include "user_rtos.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IR_SECONDS     6
+#define IR_FRAMES      (SAMPLE_RATE * IR_SECONDS)
+#define IMPULSE        0.5f
+#define RT60_TOL       0.20
+
+static float ir_l[IR_FRAMES], ir_r[IR_FRAMES];
+static int failures;
+
+static void check(int ok, const char *what) {
+	printf("%-4s %s\n", ok ? "ok" : "FAIL", what);
+	if (!ok)
+		failures++;
+}
+
+// 라인/디퓨저/필터 상태를 비우고 임펄스 응답 (웻만: 입력은 0번 프레임에만 있으므로 이후 = 웻)
+static void run_ir(float decay_s, float damping, int frames) {
+	static int inited;
+	float l[MOD_SUBBLOCK], r[MOD_SUBBLOCK];
+
+	g_reverb.enabled = 1;
+	g_reverb.decay_s = decay_s;
+	g_reverb.damping = damping;
+	g_reverb.mix = 1.0f;
+
+	// Init 은 아레나를 다시 할당하지 않도록 처음 한 번만, 이후는 무음으로 흘려 비움
+	if (!inited) {
+		FX_Reverb_Init();
+		inited = 1;
+	}
+	memset(l, 0, sizeof(l));
+	memset(r, 0, sizeof(r));
+	for (int f = 0; f < IR_FRAMES; f += MOD_SUBBLOCK) {
+		memset(l, 0, sizeof(l));
+		memset(r, 0, sizeof(r));
+		FX_Reverb_Process(l, r, MOD_SUBBLOCK);
+	}
+
+	for (int f = 0; f < frames; f += MOD_SUBBLOCK) {
+		int n = frames - f;
+		if (n > MOD_SUBBLOCK)
+			n = MOD_SUBBLOCK;
+		for (int j = 0; j < n; j++)
+			l[j] = r[j] = (f + j == 0) ? IMPULSE : 0.0f;
+		FX_Reverb_Process(l, r, n);
+		for (int j = 0; j < n; j++) {
+			ir_l[f + j] = l[j] - ((f + j == 0) ? IMPULSE : 0.0f);
+			ir_r[f + j] = r[j] - ((f + j == 0) ? IMPULSE : 0.0f);
+		}
+	}
+}
+
+// Schroeder 역적분 → -5 dB, -35 dB 시각으로 RT60 (초), 실패 시 -1
+static double rt60(int frames) {
+	static double edc[IR_FRAMES];
+	double acc = 0.0;
+
+	for (int i = frames - 1; i >= 0; i--) {
+		acc += (double) ir_l[i] * ir_l[i] + (double) ir_r[i] * ir_r[i];
+		edc[i] = acc;
+	}
+	if (acc <= 0.0)
+		return -1.0;
+
+	int t5 = -1, t35 = -1;
+	for (int i = 0; i < frames; i++) {
+		double db = 10.0 * log10(edc[i] / acc + 1e-30);
+		if (t5 < 0 && db <= -5.0)
+			t5 = i;
+		if (t35 < 0 && db <= -35.0) {
+			t35 = i;
+			break;
+		}
+	}
+	if (t5 < 0 || t35 < 0)
+		return -1.0;
+	return 2.0 * (double) (t35 - t5) / SAMPLE_RATE;
+}
+
+static double energy(const float *x, int a, int b) {
+	double e = 0.0;
+	for (int i = a; i < b; i++)
+		e += (double) x[i] * x[i];
+	return e;
+}
+
+// 1차 차분 에너지 / 에너지 (0 ~ 4, 클수록 고역이 많음)
+static double hf_ratio(int a, int b) {
+	double d = 0.0, e = 0.0;
+	for (int i = a + 1; i < b; i++) {
+		double dl = ir_l[i] - ir_l[i - 1], dr = ir_r[i] - ir_r[i - 1];
+		d += dl * dl + dr * dr;
+		e += (double) ir_l[i] * ir_l[i] + (double) ir_r[i] * ir_r[i];
+	}
+	return (e > 0.0) ? d / e : 0.0;
+}
+
+static void write_wav(const char *path, int frames) {
+	FILE *f = fopen(path, "wb");
+	if (!f) {
+		fprintf(stderr, "%s: 쓸 수 없음\n", path);
+		exit(2);
+	}
+	uint32_t data = (uint32_t) frames * 4u;
+	uint32_t h[11] = { 0x46464952u, 36u + data, 0x45564157u, 0x20746d66u, 16u,
+			1u | (2u << 16), SAMPLE_RATE, SAMPLE_RATE * 4u, 4u | (16u << 16),
+			0x61746164u, data };
+	fwrite(h, 4, 11, f); // 리틀 엔디언 호스트 기준
+	for (int i = 0; i < frames; i++) {
+		int16_t s[2] = { (int16_t) lrintf(ir_l[i] * 32767.0f / IMPULSE * 0.5f),
+				(int16_t) lrintf(ir_r[i] * 32767.0f / IMPULSE * 0.5f) };
+		fwrite(s, 2, 2, f);
+	}
+	fclose(f);
+}
+
+int main(int argc, char **argv) {
+	const char *wav = NULL;
+	char what[160];
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+			wav = argv[++i];
+		} else {
+			fprintf(stderr, "사용: %s [-o ir.wav]\n", argv[0]);
+			return 2;
+		}
+	}
+	printf("REVERB_PRESET %d, %u B\n", REVERB_PRESET,
+			(unsigned) FX_REVERB_RAM_BYTES);
+
+	// 1) RT60 정확도 (damping 0 → 라인 감쇠 게인만)
+	const float decays[2] = { 1.0f, 2.0f };
+	for (int k = 0; k < 2; k++) {
+		run_ir(decays[k], 0.0f, IR_FRAMES);
+		double t = rt60(IR_FRAMES);
+		snprintf(what, sizeof(what), "RT60 %.1f s 설정 → 측정 %.3f s (T30)",
+				decays[k], t);
+		check(t > 0.0 && fabs(t - decays[k]) <= RT60_TOL * decays[k], what);
+	}
+
+	// 2) 안정성 + 꼬리 (1초 설정, 6초 동안)
+	run_ir(1.0f, 0.0f, IR_FRAMES);
+	{
+		float peak = 0.0f;
+		int finite = 1;
+		for (int i = 0; i < IR_FRAMES; i++) {
+			if (!isfinite(ir_l[i]) || !isfinite(ir_r[i]))
+				finite = 0;
+			if (fabsf(ir_l[i]) > peak)
+				peak = fabsf(ir_l[i]);
+			if (fabsf(ir_r[i]) > peak)
+				peak = fabsf(ir_r[i]);
+		}
+		snprintf(what, sizeof(what), "출력 유한, 피크 %.3f (< 1.0)", peak);
+		check(finite && peak < 1.0f, what);
+
+		// 첫 50 ms 대비 마지막 100 ms 에너지 밀도
+		const int early = SAMPLE_RATE / 20, late = SAMPLE_RATE / 10;
+		double e0 = (energy(ir_l, 0, early) + energy(ir_r, 0, early)) / early;
+		double e1 = (energy(ir_l, IR_FRAMES - late, IR_FRAMES)
+				+ energy(ir_r, IR_FRAMES - late, IR_FRAMES)) / late;
+		double db = 10.0 * log10(e1 / e0 + 1e-30);
+		snprintf(what, sizeof(what), "%d 초 뒤 꼬리 %.1f dB (< -60 dB)",
+				IR_SECONDS, db);
+		check(db < -60.0, what);
+
+		// 3) L/R 상관 (처음 10 ms 이후 500 ms)
+		const int a = SAMPLE_RATE / 100, b = a + SAMPLE_RATE / 2;
+		double lr = 0.0;
+		for (int i = a; i < b; i++)
+			lr += (double) ir_l[i] * ir_r[i];
+		double rho = lr / sqrt(energy(ir_l, a, b) * energy(ir_r, a, b) + 1e-30);
+		snprintf(what, sizeof(what), "L/R 상관계수 %.3f (|r| < 0.5)", rho);
+		check(fabs(rho) < 0.5, what);
+
+		if (wav) {
+			write_wav(wav, SAMPLE_RATE * 3);
+			printf("wrote %s (RT60 1 s, damping 0, 3 s)\n", wav);
+		}
+	}
+
+	// 4) damping: 200 ~ 700 ms 구간의 고역 비율
+	{
+		const int a = SAMPLE_RATE / 5, b = SAMPLE_RATE * 7 / 10;
+		run_ir(2.0f, 0.0f, IR_FRAMES / 2);
+		double bright = hf_ratio(a, b);
+		run_ir(2.0f, 0.8f, IR_FRAMES / 2);
+		double dark = hf_ratio(a, b);
+		snprintf(what, sizeof(what),
+				"damping 0.8 고역 비율 %.3f < damping 0 의 %.3f", dark, bright);
+		check(dark < 0.5 * bright, what);
+	}
+
+	printf("%s (%d 실패)\n", failures ? "FAIL" : "PASS", failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * tuning_test.c
+ *
+ *  tuning.c (12평균율 테이블 + Scala 파서) 호스트 테스트
+ *
+ *  빌드:  gcc -O2 -o tuning_test -ITools/lcd_sim/shim -ICore/Inc \
+ *             Tools/tests/tuning_test.c Core/Src/tuning.c -lm
+ *  사용:  ./tuning_test [scl 폴더]      (기본 Tools/tests/scl, 실패가 있으면 종료 코드 1)
+ *
+ *  - 정상 입력: 테이블 전체(128음)를 double 로 계산한 기대값과 비교 (허용 0.01 cent)
+ *  - 오류 입력: -1 반환 + 기존 테이블이 그대로인지 확인
+ *  - 기대값 규칙은 tuning.c 와 같음: 0번 음 = TUNING_REF_NOTE (12평균율 C4 높이),
+ *    나이퀴스트(2^31) 이상은 잘림
+ */
+
+#include "tuning.h"
+#include "user_rtos.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_SCL_BYTES   16384
+#define TOL_CENTS       0.01
+
+static const char *scl_dir = "Tools/tests/scl";
+static int failures;
+
+static char* load_scl(const char *name) {
+	static char buf[MAX_SCL_BYTES];
+	char path[512];
+	snprintf(path, sizeof(path), "%s/%s", scl_dir, name);
+
+	FILE *f = fopen(path, "rb");
+	if (!f) {
+		fprintf(stderr, "%s: 열 수 없음\n", path);
+		exit(2);
+	}
+	size_t n = fread(buf, 1, sizeof(buf) - 1, f);
+	fclose(f);
+	buf[n] = '\0';
+	return buf;
+}
+
+// cents[0 .. n-1] (마지막 = 주기) → 기대 tuning word
+static uint32_t expect_word(const double *cents, int n, int note) {
+	const double ref = TUNING_A4_FREQ * pow(2.0, (TUNING_REF_NOTE - 69) / 12.0);
+	int d = note - TUNING_REF_NOTE;
+	int oct = d / n, deg = d % n;
+	if (deg < 0) {
+		deg += n;
+		oct--;
+	}
+	double c = oct * cents[n - 1] + ((deg > 0) ? cents[deg - 1] : 0.0);
+	double w = ref * pow(2.0, c / 1200.0) * (4294967296.0 / SAMPLE_RATE);
+	return (w > 2147483647.0) ? 2147483647u : (uint32_t) w;
+}
+
+static void check(int ok, const char *name, const char *what) {
+	printf("%-4s %-16s %s\n", ok ? "ok" : "FAIL", name, what);
+	if (!ok)
+		failures++;
+}
+
+// 테이블 전체를 기대 스케일과 비교 → 최대 오차 (cent)
+static double table_error(const double *cents, int n, int *clipped) {
+	double worst = 0.0;
+	*clipped = 0;
+	for (int note = 0; note < TUNING_NUM_NOTES; note++) {
+		uint32_t e = expect_word(cents, n, note);
+		uint32_t g = Tuning_Word((uint8_t) note);
+		if (e == 2147483647u) {
+			(*clipped)++;
+			if (g != e)
+				return 1e9;
+			continue;
+		}
+		double err = fabs(1200.0 * log2((double) g / (double) e));
+		if (err > worst)
+			worst = err;
+	}
+	return worst;
+}
+
+static void expect_table(const char *name, const double *cents, int n) {
+	char what[96];
+	int clipped;
+	double err = table_error(cents, n, &clipped);
+	snprintf(what, sizeof(what), "128음 최대 오차 %.4f cent%s", err,
+			clipped ? " (나이퀴스트 잘림 포함)" : "");
+	check(err <= TOL_CENTS, name, what);
+}
+
+static void expect_load(const char *file, const double *cents, int n) {
+	int r = Tuning_LoadScala(load_scl(file));
+	check(r == 0, file, "로드 성공");
+	if (r == 0)
+		expect_table(file, cents, n);
+}
+
+// 형식 오류 → -1, 테이블은 직전 상태 그대로
+static void expect_reject(const char *file) {
+	static uint32_t before[TUNING_NUM_NOTES];
+	memcpy(before, g_tuning_words, sizeof(before));
+	int r = Tuning_LoadScala(load_scl(file));
+	check(r == -1 && memcmp(before, g_tuning_words, sizeof(before)) == 0,
+			file, "거부 (-1), 테이블 유지");
+}
+
+static double ratio_cents(double num, double den) {
+	return 1200.0 * log2(num / den);
+}
+
+int main(int argc, char **argv) {
+	double tet[12], ji[12], bp[13], ed[5], big[TUNING_MAX_DEGREES];
+
+	if (argc > 1)
+		scl_dir = argv[1];
+
+	for (int i = 0; i < 12; i++)
+		tet[i] = 100.0 * (i + 1);
+
+	// 1) 기본 테이블: 12평균율, A4 = 440Hz
+	Tuning_Init();
+	expect_table("Tuning_Init", tet, 12);
+	{
+		double a4 = (double) Tuning_Word(69) * SAMPLE_RATE / 4294967296.0;
+		char what[64];
+		snprintf(what, sizeof(what), "A4 = %.4f Hz", a4);
+		check(fabs(a4 - 440.0) < 0.001, "Tuning_Init", what);
+	}
+
+	// 2) 정상 입력
+	expect_load("12tet.scl", tet, 12);
+
+	const int jn[12][2] = { { 16, 15 }, { 9, 8 }, { 6, 5 }, { 5, 4 }, { 4, 3 },
+			{ 45, 32 }, { 3, 2 }, { 8, 5 }, { 5, 3 }, { 9, 5 }, { 15, 8 }, { 2,
+					1 } };
+	for (int i = 0; i < 12; i++)
+		ji[i] = ratio_cents(jn[i][0], jn[i][1]);
+	expect_load("ji5.scl", ji, 12);
+
+	for (int i = 0; i < 13; i++)
+		bp[i] = ratio_cents(3, 1) * (i + 1) / 13.0;
+	expect_load("bp.scl", bp, 13);
+
+	// 설명 줄이 비어 있어도 (Scala 형식에서 허용) 음 개수 줄로 착각하지 않아야 함
+	for (int i = 0; i < 4; i++)
+		ed[i] = 240.0 * (i + 1);
+	ed[4] = 1200.0;
+	expect_load("empty_desc.scl", ed, 5);
+
+	// 최대 음 수 + 나이퀴스트 잘림
+	for (int i = 0; i < TUNING_MAX_DEGREES; i++)
+		big[i] = 200.0 * (i + 1);
+	expect_load("max.scl", big, TUNING_MAX_DEGREES);
+
+	// 3) 오류 입력 (직전 로드 = max.scl 테이블이 유지되어야 함)
+	expect_reject("bad_value.scl");
+	expect_reject("short.scl");
+	expect_reject("zero_den.scl");
+	expect_reject("neg_period.scl");
+	expect_reject("too_many.scl");
+	{
+		static uint32_t before[TUNING_NUM_NOTES];
+		memcpy(before, g_tuning_words, sizeof(before));
+		check(Tuning_LoadScala(NULL) == -1
+				&& Tuning_LoadScala("! 주석만\n") == -1
+				&& Tuning_LoadScala("설명\n0\n") == -1
+				&& memcmp(before, g_tuning_words, sizeof(before)) == 0,
+				"inline", "NULL / 주석만 / 음 0개 거부");
+	}
+
+	printf("%s (%d 실패)\n", failures ? "FAIL" : "PASS", failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,264 @@
+/*
+ * wav2wt.c
+ *
+ *  단일 주기 WAV 파일들 → 웨이브테이블 C 소스 변환기 (PC에서 실행)
+ *
+ *  빌드:  gcc -O2 -o wav2wt Tools/wav2wt.c -lm
+ *  사용:  ./wav2wt [-n 이름] 출력.c 프레임0.wav 프레임1.wav ...
+ *         ./wav2wt --demo [-n 이름] 출력.c   (기본 테이블: 사인 → 톱니 → 사각)
+ *
+ *  - 입력: RIFF/WAVE, PCM 8/16/24/32비트 또는 32비트 float, 채널은 첫 번째만 사용
+ *  - 각 파일 = 한 주기, WT_FRAME_SIZE 샘플로 순환 선형 리샘플링
+ *  - 프레임별 DC 제거 후 프레임마다 피크를 WT_AMPLITUDE 로 정규화 (모핑 중 음량 유지)
+ *  - 프레임이 1개면 복제해서 2개로 (펌웨어 보간이 다음 프레임을 항상 읽음)
+ *  - 출력 파일은 Core/Src/ 에 넣고 wavetable.h 의 Wavetable_t 로 참조
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WT_FRAME_SIZE   256     // Core/Inc/wavetable.h 와 같아야 함
+#define WT_AMPLITUDE    7000    // LUT_AMPLITUDE 와 같은 레벨
+#define WT_MAX_FRAMES   64
+#define DEMO_FRAMES     8
+
+static float frames[WT_MAX_FRAMES][WT_FRAME_SIZE];
+
+static uint32_t rd_u32(const uint8_t *p) {
+	return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16)
+			| ((uint32_t) p[3] << 24);
+}
+
+static uint16_t rd_u16(const uint8_t *p) {
+	return (uint16_t) (p[0] | (p[1] << 8));
+}
+
+// WAV 한 개 읽기 → 첫 채널 샘플 (-1.0 ~ 1.0), 샘플 수 반환 (실패 시 0)
+static size_t load_wav(const char *path, float **out) {
+	FILE *fp = fopen(path, "rb");
+	if (!fp) {
+		fprintf(stderr, "%s: 열 수 없음\n", path);
+		return 0;
+	}
+	fseek(fp, 0, SEEK_END);
+	long size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	uint8_t *buf = malloc((size_t) size);
+	if (!buf || fread(buf, 1, (size_t) size, fp) != (size_t) size) {
+		fclose(fp);
+		free(buf);
+		return 0;
+	}
+	fclose(fp);
+
+	if (size < 12 || memcmp(buf, "RIFF", 4) || memcmp(buf + 8, "WAVE", 4)) {
+		fprintf(stderr, "%s: WAV 형식 아님\n", path);
+		free(buf);
+		return 0;
+	}
+
+	uint16_t fmt = 0, channels = 0, bits = 0;
+	const uint8_t *data = NULL;
+	uint32_t data_len = 0;
+
+	// 청크 순회 (fmt / data 만 사용)
+	long pos = 12;
+	while (pos + 8 <= size) {
+		uint32_t len = rd_u32(buf + pos + 4);
+		const uint8_t *body = buf + pos + 8;
+		if (pos + 8 + (long) len > size)
+			len = (uint32_t) (size - pos - 8);
+
+		if (!memcmp(buf + pos, "fmt ", 4) && len >= 16) {
+			fmt = rd_u16(body);
+			channels = rd_u16(body + 2);
+			bits = rd_u16(body + 14);
+			if (fmt == 0xFFFE && len >= 26)
+				fmt = rd_u16(body + 24); // WAVE_FORMAT_EXTENSIBLE
+		} else if (!memcmp(buf + pos, "data", 4)) {
+			data = body;
+			data_len = len;
+		}
+		pos += 8 + len + (len & 1);
+	}
+
+	if (!data || channels == 0 || (fmt != 1 && fmt != 3)
+			|| (fmt == 3 && bits != 32)) {
+		fprintf(stderr, "%s: 지원하지 않는 형식 (fmt=%u bits=%u)\n", path, fmt,
+				bits);
+		free(buf);
+		return 0;
+	}
+
+	size_t stride = (size_t) channels * (bits / 8);
+	size_t count = data_len / stride;
+	float *s = malloc(count * sizeof(float));
+
+	for (size_t i = 0; i < count; i++) {
+		const uint8_t *p = data + i * stride;
+		switch (bits) {
+		case 8:
+			s[i] = ((float) p[0] - 128.0f) / 128.0f;
+			break;
+		case 16:
+			s[i] = (float) (int16_t) rd_u16(p) / 32768.0f;
+			break;
+		case 24:
+			s[i] = (float) ((int32_t) ((uint32_t) p[0] << 8 | (uint32_t) p[1] << 16
+					| (uint32_t) p[2] << 24) >> 8) / 8388608.0f;
+			break;
+		default: // 32
+			if (fmt == 3) {
+				uint32_t u = rd_u32(p);
+				float f;
+				memcpy(&f, &u, sizeof(f));
+				s[i] = f;
+			} else {
+				s[i] = (float) (int32_t) rd_u32(p) / 2147483648.0f;
+			}
+			break;
+		}
+	}
+
+	free(buf);
+	*out = s;
+	return count;
+}
+
+// 한 주기를 WT_FRAME_SIZE 로 순환 선형 리샘플링 + DC 제거
+static void resample_frame(const float *src, size_t len, float *dst) {
+	double dc = 0.0;
+	for (int i = 0; i < WT_FRAME_SIZE; i++) {
+		double x = (double) i * (double) len / WT_FRAME_SIZE;
+		size_t i0 = (size_t) x;
+		double fr = x - (double) i0;
+		float a = src[i0 % len];
+		float b = src[(i0 + 1) % len];
+		dst[i] = (float) (a + (b - a) * fr);
+		dc += dst[i];
+	}
+	dc /= WT_FRAME_SIZE;
+	for (int i = 0; i < WT_FRAME_SIZE; i++)
+		dst[i] -= (float) dc;
+}
+
+// 데모 테이블: t = 0 사인, 0.5 톱니, 1.0 사각 (배음 합성, 나이퀴스트 아래까지만)
+static int make_demo(void) {
+	const int max_h = WT_FRAME_SIZE / 2 - 1;
+
+	for (int k = 0; k < DEMO_FRAMES; k++) {
+		float t = (float) k / (DEMO_FRAMES - 1);
+
+		for (int i = 0; i < WT_FRAME_SIZE; i++) {
+			double ph = 2.0 * M_PI * i / WT_FRAME_SIZE;
+			double v = 0.0;
+			for (int h = 1; h <= max_h; h++) {
+				double saw = 1.0 / h;
+				double sq = (h & 1) ? 1.0 / h : 0.0;
+				double sine = (h == 1) ? 1.0 : 0.0;
+				double amp = (t < 0.5f) ?
+						sine + (saw - sine) * (t * 2.0) :
+						saw + (sq - saw) * ((t - 0.5) * 2.0);
+				v += amp * sin(h * ph);
+			}
+			frames[k][i] = (float) v;
+		}
+	}
+	return DEMO_FRAMES;
+}
+
+static int write_table(const char *path, const char *name, int n) {
+	FILE *fp = fopen(path, "w");
+	if (!fp) {
+		fprintf(stderr, "%s: 쓸 수 없음\n", path);
+		return -1;
+	}
+
+	fprintf(fp, "/*\n * %s\n *\n", strrchr(path, '/') ? strrchr(path, '/') + 1 : path);
+	fprintf(fp, " *  Tools/wav2wt.c 로 생성된 웨이브테이블 (직접 수정하지 말 것)\n");
+	fprintf(fp, " *  %d 프레임 x %d 샘플 (재생성 방법은 Tools/wav2wt.c 참고)\n */\n\n", n,
+			WT_FRAME_SIZE);
+	fprintf(fp, "#include \"wavetable.h\"\n\n");
+	fprintf(fp, "#if WT_FRAME_SIZE != %d\n#error \"WT_FRAME_SIZE mismatch\"\n#endif\n\n",
+	WT_FRAME_SIZE);
+	fprintf(fp, "static const int16_t %s_data[%d * WT_FRAME_SIZE] = {\n", name, n);
+
+	for (int k = 0; k < n; k++) {
+		float peak = 0.0f;
+		for (int i = 0; i < WT_FRAME_SIZE; i++)
+			if (fabsf(frames[k][i]) > peak)
+				peak = fabsf(frames[k][i]);
+		float gain = (peak > 0.0f) ? WT_AMPLITUDE / peak : 0.0f;
+
+		fprintf(fp, "\t// frame %d\n", k);
+		for (int i = 0; i < WT_FRAME_SIZE; i++) {
+			long v = lrintf(frames[k][i] * gain);
+			if ((i & 15) == 0)
+				fprintf(fp, "\t");
+			fprintf(fp, "%ld,", v);
+			fprintf(fp, ((i & 15) == 15) ? "\n" : " ");
+		}
+	}
+	fprintf(fp, "};\n\nconst Wavetable_t %s = { .data = %s_data, .num_frames = %d };\n",
+			name, name, n);
+	fclose(fp);
+	return 0;
+}
+
+int main(int argc, char **argv) {
+	const char *name = "g_wt_user";
+	int demo = 0;
+	int argi = 1;
+
+	while (argi < argc && argv[argi][0] == '-') {
+		if (!strcmp(argv[argi], "--demo")) {
+			demo = 1;
+			name = "g_wt_default";
+			argi++;
+		} else if (!strcmp(argv[argi], "-n") && argi + 1 < argc) {
+			name = argv[argi + 1];
+			argi += 2;
+		} else {
+			break;
+		}
+	}
+
+	if (argi >= argc || (!demo && argi + 1 >= argc)) {
+		fprintf(stderr, "usage: %s [-n name] out.c in0.wav [in1.wav ...]\n"
+				"       %s --demo [-n name] out.c\n", argv[0], argv[0]);
+		return 1;
+	}
+
+	const char *out_path = argv[argi++];
+	int n;
+
+	if (demo) {
+		n = make_demo();
+	} else {
+		n = 0;
+		for (; argi < argc && n < WT_MAX_FRAMES; argi++) {
+			float *s = NULL;
+			size_t len = load_wav(argv[argi], &s);
+			if (len < 2) {
+				free(s);
+				return 1;
+			}
+			resample_frame(s, len, frames[n++]);
+			free(s);
+		}
+		if (n == 1) {
+			memcpy(frames[1], frames[0], sizeof(frames[0]));
+			n = 2;
+		}
+	}
+
+	if (write_table(out_path, name, n) != 0)
+		return 1;
+	printf("%s: %d frames (%u bytes flash)\n", out_path, n,
+			(unsigned) (n * WT_FRAME_SIZE * sizeof(int16_t)));
+	return 0;
+}